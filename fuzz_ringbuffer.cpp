@@ -0,0 +1,371 @@
+/**
+ * \file fuzz_ringbuffer.cpp
+ * \brief Ring buffer fuzz / property test harness
+ * \details Random operation sequences are run on a ring buffer and on a std::deque reference model,
+ * every result, every byte read and the length / free size are compared after each step;
+ * The storage array is allocated with the exact size so ASan catches any access past its end;
+ * Build with libFuzzer (clang), the C files are compiled as C:
+ *      clang -g -O1 -fsanitize=fuzzer-no-link,address,undefined -c ring_buffer.c ring_buffer_crc.c
+ *      clang++ -g -O1 -fsanitize=fuzzer,address,undefined fuzz_ringbuffer.cpp ring_buffer.o ring_buffer_crc.o -o fuzz_rb
+ *      ./fuzz_rb -max_len=4096 -timeout=5
+ * Build with FUZZ_SPSC for the lock-free buffer, producer and consumer run in two threads under TSan:
+ *      clang -g -O1 -fsanitize=fuzzer-no-link,thread -c fuzz_ringbuffer_spsc.c ring_buffer_spsc.c
+ *      clang++ -g -O1 -DFUZZ_SPSC -fsanitize=fuzzer,thread fuzz_ringbuffer.cpp fuzz_ringbuffer_spsc.o ring_buffer_spsc.o -o fuzz_rb_spsc
+ * Add -DRING_BUFFER_EMPTY_SLOT to every command to check the empty slot full detection
+ * Without libFuzzer (gcc), add -DFUZZ_STANDALONE and drop "fuzzer" from -fsanitize, arguments are input files,
+ * with no argument random inputs are generated, after a fixed check of in-place resize on a ring larger than 2 GB
+ * whose data wraps with head + length past 4 GB (needs 4 GB of address space, pages are only reserved):
+ *      gcc -g -O1 -fsanitize=address,undefined -c ring_buffer.c ring_buffer_crc.c
+ *      g++ -g -O1 -DFUZZ_STANDALONE -fsanitize=address,undefined fuzz_ringbuffer.cpp ring_buffer.o ring_buffer_crc.o -o fuzz_rb
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.1.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+ * 2026.10.16 v1.1.0 Standalone build checks grow / shrink in place with a head pointer near 4 GB
+*/
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <vector>
+#if defined(FUZZ_STANDALONE) && !defined(FUZZ_SPSC)
+#include <sys/mman.h>
+#endif
+
+extern "C"
+{
+#ifdef FUZZ_SPSC
+int Fuzz_SPSC_Run(const uint8_t *data, size_t size); //fuzz_ringbuffer_spsc.c
+#else
+#include "ring_buffer.h"
+#include "ring_buffer_crc.h"
+#endif
+}
+
+// Report a mismatch with the step number and stop, libFuzzer saves the input that caused it
+#define FUZZ_CHECK(condition)                                                          \
+    do                                                                                 \
+    {                                                                                  \
+        if (!(condition))                                                              \
+        {                                                                              \
+            fprintf(stderr, "%s:%d step %u: %s\n", __FILE__, __LINE__, step, #condition); \
+            abort();                                                                   \
+        }                                                                              \
+    } while (0)
+
+#ifndef FUZZ_SPSC
+// Operation codes, one input byte selects the operation, the following bytes are its arguments
+enum
+{
+    FUZZ_WRITE_BYTE,
+    FUZZ_READ_BYTE,
+    FUZZ_WRITE_STRING,
+    FUZZ_READ_STRING,
+    FUZZ_DELETE,
+    FUZZ_INSERT_KEYWORD,
+    FUZZ_FIND_KEYWORD,
+    FUZZ_RESIZE,
+    FUZZ_GROW_IN_PLACE,
+    FUZZ_SHRINK_IN_PLACE,
+    FUZZ_WRITE_STRING_CRC,
+    FUZZ_READ_STRING_CRC,
+    FUZZ_OP_COUNT
+};
+
+// Input reader, returns 0 once the input is used up
+struct fuzz_input
+{
+    const uint8_t *data;
+    size_t size;
+    uint32_t get(uint32_t bytes)
+    {
+        uint32_t value = 0;
+        while (bytes-- && size)
+        {
+            value = (value << 8) | *data++;
+            size--;
+        }
+        return value;
+    }
+};
+
+// Bytes Find_Keyword looks for: the low keyword_lenght bytes of the keyword, most significant first
+static std::vector<uint8_t> Fuzz_Keyword_Bytes(uint32_t keyword, uint32_t keyword_lenght)
+{
+    std::vector<uint8_t> bytes;
+    for (uint32_t i = keyword_lenght; i-- > 0;)
+        bytes.push_back((uint8_t)(keyword >> (8 * i)));
+    return bytes;
+}
+
+// Reference model of Ring_Buffer_Find_Keyword: 1-based distance to the first match, 0: not found
+static uint32_t Fuzz_Find_Keyword(const std::deque<uint8_t> &model, uint32_t keyword, uint32_t keyword_lenght)
+{
+    if (keyword_lenght < 4 && (keyword >> (8 * keyword_lenght)) != 0)
+        return 0; //Bits above the keyword length can never match
+    std::vector<uint8_t> bytes = Fuzz_Keyword_Bytes(keyword, keyword_lenght);
+    for (size_t i = 0; i + keyword_lenght <= model.size(); i++)
+        if (std::equal(bytes.begin(), bytes.end(), model.begin() + i))
+            return (uint32_t)i + 1;
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    fuzz_input input = {data, size};
+    uint32_t max_length = 2 + input.get(1); //2 .. 257 bytes, small sizes wrap often
+    uint8_t *array = new uint8_t[max_length];
+    ring_buffer RB;
+    std::deque<uint8_t> model;
+    std::vector<uint8_t> scratch;
+    uint32_t step = 0;
+
+    scratch.reserve(1); //data() is never NULL, memcpy with length 0 still needs valid pointers
+    Ring_Buffer_Init(&RB, array, max_length);
+    while (input.size != 0)
+    {
+        uint32_t op = input.get(1) % FUZZ_OP_COUNT;
+        uint32_t free_size = max_length - RING_BUFFER_RESERVED - (uint32_t)model.size();
+        step++;
+        switch (op)
+        {
+        case FUZZ_WRITE_BYTE:
+        {
+            uint8_t rb_data = (uint8_t)input.get(1);
+            uint8_t expect = free_size != 0; //Same capacity as the string functions
+            FUZZ_CHECK(Ring_Buffer_Write_Byte(&RB, rb_data) == expect);
+            if (expect)
+                model.push_back(rb_data);
+            break;
+        }
+        case FUZZ_READ_BYTE:
+        {
+            uint8_t rb_data = Ring_Buffer_Read_Byte(&RB);
+            if (!model.empty())
+            {
+                FUZZ_CHECK(rb_data == model.front());
+                model.pop_front();
+            }
+            break;
+        }
+        case FUZZ_WRITE_STRING:
+        case FUZZ_WRITE_STRING_CRC:
+        {
+            uint32_t write_lenght = input.get(2) % (2 * max_length + 1); //Up to twice the capacity, so full is reached
+            uint8_t expect = write_lenght <= free_size;
+            scratch.resize(write_lenght);
+            for (uint32_t i = 0; i < write_lenght; i++)
+                scratch[i] = (uint8_t)(step * 31 + i);
+            if (op == FUZZ_WRITE_STRING)
+                FUZZ_CHECK(Ring_Buffer_Write_String(&RB, scratch.data(), write_lenght) == expect);
+            else
+            {
+                ring_buffer_crc crc, crc_model;
+                uint8_t type = (uint8_t)(input.get(1) % 3);
+                Ring_Buffer_CRC_Init(&crc, type);
+                Ring_Buffer_CRC_Init(&crc_model, type);
+                FUZZ_CHECK(Ring_Buffer_Write_String_CRC(&RB, scratch.data(), write_lenght, &crc) == expect);
+                if (expect)
+                    Ring_Buffer_CRC_Update(&crc_model, scratch.data(), write_lenght);
+                FUZZ_CHECK(Ring_Buffer_CRC_Get(&crc) == Ring_Buffer_CRC_Get(&crc_model));
+            }
+            if (expect)
+                model.insert(model.end(), scratch.begin(), scratch.end());
+            break;
+        }
+        case FUZZ_READ_STRING:
+        case FUZZ_READ_STRING_CRC:
+        {
+            uint32_t read_lenght = input.get(2) % (max_length + 2);
+            uint8_t expect = read_lenght <= model.size();
+            scratch.assign(read_lenght, 0);
+            if (op == FUZZ_READ_STRING)
+                FUZZ_CHECK(Ring_Buffer_Read_String(&RB, scratch.data(), read_lenght) == expect);
+            else
+            {
+                ring_buffer_crc crc, crc_model;
+                uint8_t type = (uint8_t)(input.get(1) % 3);
+                Ring_Buffer_CRC_Init(&crc, type);
+                Ring_Buffer_CRC_Init(&crc_model, type);
+                FUZZ_CHECK(Ring_Buffer_Read_String_CRC(&RB, scratch.data(), read_lenght, &crc) == expect);
+                if (expect)
+                    Ring_Buffer_CRC_Update(&crc_model, scratch.data(), read_lenght);
+                FUZZ_CHECK(Ring_Buffer_CRC_Get(&crc) == Ring_Buffer_CRC_Get(&crc_model));
+            }
+            if (expect)
+            {
+                FUZZ_CHECK(std::equal(scratch.begin(), scratch.end(), model.begin()));
+                model.erase(model.begin(), model.begin() + read_lenght);
+            }
+            break;
+        }
+        case FUZZ_DELETE:
+        {
+            uint32_t lenght = input.get(2) % (max_length + 2);
+            uint8_t expect = lenght <= model.size();
+            FUZZ_CHECK(Ring_Buffer_Delete(&RB, lenght) == expect);
+            if (expect)
+                model.erase(model.begin(), model.begin() + lenght);
+            break;
+        }
+        case FUZZ_INSERT_KEYWORD:
+        {
+            uint32_t keyword = input.get(4);
+            uint8_t keyword_lenght = (uint8_t)(1 + input.get(1) % 4);
+            uint8_t expect = keyword_lenght <= free_size;
+            FUZZ_CHECK(Ring_Buffer_Insert_Keyword(&RB, keyword, keyword_lenght) == expect);
+            if (expect)
+            {
+                std::vector<uint8_t> bytes = Fuzz_Keyword_Bytes(keyword, keyword_lenght);
+                model.insert(model.end(), bytes.begin(), bytes.end());
+            }
+            break;
+        }
+        case FUZZ_FIND_KEYWORD:
+        {
+            uint8_t keyword_lenght = (uint8_t)(1 + input.get(1) % 4);
+            uint32_t keyword = input.get(keyword_lenght); //Keyword built from the input, so matches are found often
+            FUZZ_CHECK(Ring_Buffer_Find_Keyword(&RB, keyword, keyword_lenght) == Fuzz_Find_Keyword(model, keyword, keyword_lenght));
+            break;
+        }
+        case FUZZ_RESIZE:
+        {
+            uint32_t buffer_size = 1 + input.get(1) * 2; //1 .. 511
+            uint8_t expect = buffer_size >= 2 && buffer_size - RING_BUFFER_RESERVED >= model.size();
+            uint8_t *new_array = new uint8_t[buffer_size];
+            FUZZ_CHECK(Ring_Buffer_Resize(&RB, new_array, buffer_size) == expect);
+            if (expect)
+            {
+                delete[] array;
+                array = new_array;
+                max_length = buffer_size;
+            }
+            else
+                delete[] new_array;
+            break;
+        }
+        case FUZZ_GROW_IN_PLACE:
+        {
+            //realloc: the new array starts with the old bytes, then the buffer moves its data inside it
+            uint32_t buffer_size = max_length + input.get(1);
+            uint8_t *new_array = new uint8_t[buffer_size];
+            memcpy(new_array, array, max_length);
+            delete[] array;
+            array = new_array;
+            RB.array_addr = array;
+            FUZZ_CHECK(Ring_Buffer_Grow_In_Place(&RB, buffer_size) == RING_BUFFER_SUCCESS);
+            max_length = buffer_size;
+            break;
+        }
+        case FUZZ_SHRINK_IN_PLACE:
+        {
+            //The buffer compacts its data first, then the array is cut down to the new size
+            uint32_t buffer_size = max_length - input.get(1) % max_length;
+            uint8_t expect = buffer_size >= 2 && buffer_size - RING_BUFFER_RESERVED >= model.size();
+            FUZZ_CHECK(Ring_Buffer_Shrink_In_Place(&RB, buffer_size) == expect);
+            if (expect)
+            {
+                uint8_t *new_array = new uint8_t[buffer_size];
+                memcpy(new_array, array, buffer_size);
+                delete[] array;
+                array = new_array;
+                RB.array_addr = array;
+                max_length = buffer_size;
+            }
+            break;
+        }
+        }
+        //Properties that hold after every operation
+        FUZZ_CHECK(RB.max_length == max_length);
+        FUZZ_CHECK(Ring_Buffer_Get_Length(&RB) == model.size());
+        FUZZ_CHECK(Ring_Buffer_Get_FreeSize(&RB) == max_length - RING_BUFFER_RESERVED - model.size());
+        FUZZ_CHECK(RB.head < max_length && RB.tail < max_length);
+        FUZZ_CHECK((RB.head + Ring_Buffer_Get_Length(&RB)) % max_length == RB.tail);
+    }
+    delete[] array;
+    return 0;
+}
+#else
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    uint32_t step = 0;
+    FUZZ_CHECK(Fuzz_SPSC_Run(data, size) == 0);
+    return 0;
+}
+#endif
+
+#if defined(FUZZ_STANDALONE) && !defined(FUZZ_SPSC)
+// Grow / shrink in place a wrapped ring whose head + length overflows 32 bits, the data must read back unchanged
+static void Fuzz_Large_Head(void)
+{
+    const uint32_t old_size = 0xFFFFFF00u, head = old_size - 0x100, lenght = 0x200;
+    const uint32_t sizes[2] = {0xFFFFFFF0u, old_size - 0x80}; //Grow with less new space than part B, shrink below the head pointer
+    uint8_t data[0x200], check[0x200];
+    uint32_t step = 0;
+    void *array = mmap(NULL, 0x100000000ull, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    ring_buffer RB;
+    if (array == MAP_FAILED)
+    {
+        printf("large head check skipped, no address space\r\n");
+        return;
+    }
+    for (uint32_t i = 0; i < lenght; i++)
+        data[i] = (uint8_t)(i * 7 + 1);
+    for (step = 0; step < 2; step++)
+    {
+        Ring_Buffer_Init(&RB, (uint8_t *)array, old_size);
+        RB.head = head; //Empty ring with the pointers near the end of the array
+        RB.tail = head;
+        FUZZ_CHECK(Ring_Buffer_Write_String(&RB, data, lenght) == RING_BUFFER_SUCCESS);
+        if (step == 0)
+            FUZZ_CHECK(Ring_Buffer_Grow_In_Place(&RB, sizes[step]) == RING_BUFFER_SUCCESS);
+        else
+            FUZZ_CHECK(Ring_Buffer_Shrink_In_Place(&RB, sizes[step]) == RING_BUFFER_SUCCESS);
+        FUZZ_CHECK(RB.head < sizes[step] && RB.tail < sizes[step]);
+        FUZZ_CHECK(Ring_Buffer_Get_Length(&RB) == lenght);
+        FUZZ_CHECK(Ring_Buffer_Read_String(&RB, check, lenght) == RING_BUFFER_SUCCESS);
+        FUZZ_CHECK(memcmp(data, check, lenght) == 0);
+    }
+    munmap(array, 0x100000000ull);
+}
+#endif
+
+#ifdef FUZZ_STANDALONE
+// Replay the input files given as arguments, or run random inputs when there is none
+int main(int argc, char **argv)
+{
+    std::vector<uint8_t> data;
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            FILE *file = fopen(argv[i], "rb");
+            int c;
+            if (file == NULL)
+                continue;
+            data.clear();
+            while ((c = fgetc(file)) != EOF)
+                data.push_back((uint8_t)c);
+            fclose(file);
+            LLVMFuzzerTestOneInput(data.data(), data.size());
+        }
+        return 0;
+    }
+#ifndef FUZZ_SPSC
+    Fuzz_Large_Head();
+#endif
+    srand(1);
+    for (int run = 0; run < 20000; run++)
+    {
+        data.resize(1 + rand() % 2048);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] = (uint8_t)rand();
+        LLVMFuzzerTestOneInput(data.data(), data.size());
+    }
+    printf("20000 random inputs passed\r\n");
+    return 0;
+}
+#endif
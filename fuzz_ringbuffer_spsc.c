@@ -0,0 +1,117 @@
+/**
+ * \file fuzz_ringbuffer_spsc.c
+ * \brief SPSC ring buffer fuzz driver, producer and consumer threads (used by fuzz_ringbuffer.cpp with FUZZ_SPSC)
+ * \details The input selects the buffer size, the batch sizes and the write / read chunk lengths of both sides;
+ * The producer writes a counting byte stream, the consumer checks that every byte arrives once and in order;
+ * Build under TSan to check the publish / release ordering
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include "ring_buffer_spsc.h"
+
+#define FUZZ_SPSC_TOTAL     4096 //Bytes sent per input
+
+typedef struct
+{
+    ring_buffer_spsc *ring;
+    const uint8_t *chunk; //Chunk lengths, used in turn
+    size_t chunk_count;
+    uint32_t chunk_limit; //Half the buffer size, a writer and a reader waiting for more than that could block each other
+    uint32_t error;       //Bytes received out of order
+} fuzz_spsc_side;
+
+static void *Fuzz_SPSC_Producer(void *arg)
+{
+    fuzz_spsc_side *side = (fuzz_spsc_side *)arg;
+    uint8_t chunk[256];
+    uint32_t sent = 0, i, step = 0;
+    while (sent < FUZZ_SPSC_TOTAL)
+    {
+        uint32_t lenght = 1 + side->chunk[step++ % side->chunk_count] % side->chunk_limit;
+        if (lenght > FUZZ_SPSC_TOTAL - sent)
+            lenght = FUZZ_SPSC_TOTAL - sent;
+        for (i = 0; i < lenght; i++)
+            chunk[i] = (uint8_t)(sent + i);
+        if (lenght == 1 ? Ring_Buffer_SPSC_Write_Byte(side->ring, chunk[0]) : Ring_Buffer_SPSC_Write_String(side->ring, chunk, lenght))
+            sent += lenght;
+        else
+            sched_yield(); //Full, let the consumer run
+    }
+    Ring_Buffer_SPSC_Flush(side->ring);
+    return NULL;
+}
+
+static void *Fuzz_SPSC_Consumer(void *arg)
+{
+    fuzz_spsc_side *side = (fuzz_spsc_side *)arg;
+    uint8_t chunk[256];
+    uint32_t received = 0, i, step = 0;
+    while (received < FUZZ_SPSC_TOTAL)
+    {
+        uint32_t lenght = 1 + side->chunk[step++ % side->chunk_count] % side->chunk_limit;
+        if (lenght > FUZZ_SPSC_TOTAL - received)
+            lenght = FUZZ_SPSC_TOTAL - received;
+        if (lenght == 1 ? Ring_Buffer_SPSC_Read_Byte(side->ring, chunk) : Ring_Buffer_SPSC_Read_String(side->ring, chunk, lenght))
+        {
+            for (i = 0; i < lenght; i++)
+                if (chunk[i] != (uint8_t)(received + i))
+                    side->error++;
+            received += lenght;
+        }
+        else
+            sched_yield(); //Empty, let the producer run
+    }
+    Ring_Buffer_SPSC_Release(side->ring);
+    return NULL;
+}
+
+/**
+ * \brief Run one input
+ * \param[in] data: Fuzz input
+ * \param[in] size: Input length
+ * \return Return the number of bytes received out of order, 0: pass
+*/
+int Fuzz_SPSC_Run(const uint8_t *data, size_t size)
+{
+    static const uint8_t default_chunk = 0;
+    ring_buffer_spsc *ring;
+    uint8_t *array;
+    uint32_t max_length;
+    fuzz_spsc_side producer, consumer;
+    pthread_t producer_thread, consumer_thread;
+    size_t half;
+
+    if (size < 3)
+        return 0;
+    max_length = 2u << (data[0] % 9); //2 .. 512 bytes
+    ring = aligned_alloc(RING_BUFFER_CACHE_LINE, sizeof(ring_buffer_spsc));
+    array = malloc(max_length);
+    Ring_Buffer_SPSC_Init(ring, array, max_length);
+    Ring_Buffer_SPSC_Set_Batch(ring, data[1] % max_length, data[2] % max_length);
+    data += 3;
+    size -= 3;
+
+    //First half of the input: producer chunk lengths, second half: consumer chunk lengths
+    half = size / 2;
+    producer.ring = consumer.ring = ring;
+    producer.chunk = half ? data : &default_chunk;
+    producer.chunk_count = half ? half : 1;
+    consumer.chunk = (size - half) ? data + half : &default_chunk;
+    consumer.chunk_count = (size - half) ? size - half : 1;
+    producer.chunk_limit = consumer.chunk_limit = max_length / 2;
+    producer.error = consumer.error = 0;
+
+    pthread_create(&producer_thread, NULL, Fuzz_SPSC_Producer, &producer);
+    pthread_create(&consumer_thread, NULL, Fuzz_SPSC_Consumer, &consumer);
+    pthread_join(producer_thread, NULL);
+    pthread_join(consumer_thread, NULL);
+
+    free(array);
+    free(ring);
+    return (int)consumer.error;
+}
@@ -6,17 +6,30 @@
  * No need to manually empty the data buffer, as long as the last received data is read, the buffer is ready to receive the next paragraph;
  * Save time to manually empty the normal buffer area, able to enhance the operational efficiency of the serial program;
  * \author netube_99\netube@163.com
- * \date 2021.01.30
- * \version v1.3.1
+ * \date 2026.10.16
+ * \version v1.27.1
  * 
  * 2021.01.19 v1.0.0 Release the first version
  * 2021.01.24 v1.1.0 Add a matching function
  * 2021.01.27 v1.2.0 Remaster matching character lookup feature, now supported 8 digits to 32-bit keyword queries
  * 2021.01.28 v1.3.0 The reset function is modified to delete functions, add keyword insert function (adaptive size end)
  * 2021.01.30 v1.3.1 Fixed a small probability pointer overflow error in String read and write functions
+ * 2026.10.16 v1.14.0 Add resize functions, contents are kept and relinearized with one pass of copying
+ * 2026.10.16 v1.17.0 Add operation counters, compiled in with RING_BUFFER_STATS
+ * 2026.10.16 v1.18.0 Add occupancy / latency histogram hooks, compiled in with RING_BUFFER_TRACE
+ * 2026.10.16 v1.19.0 Add USDT probes on string read / write, keyword search and full / empty rejections
+ * 2026.10.16 v1.20.0 Fix edge cases found by the fuzz harness: byte write after a full string write, keyword search in short data, short keyword insert
+ * 2026.10.16 v1.21.0 Byte and string functions share the same capacity, full detection by counter or by one empty slot (RING_BUFFER_EMPTY_SLOT)
+ * 2026.10.16 v1.22.0 Delete takes a 32-bit length
+ * 2026.10.16 v1.23.0 String reads / writes copy through RING_BUFFER_COPY_IN / OUT, RING_BUFFER_NT_COPY streams large transfers past the cache
+ * 2026.10.16 v1.24.0 Keyword search scans for the trigger byte span by span with RING_BUFFER_FIND_BYTE (memchr or a SIMD kernel)
+ * 2026.10.16 v1.25.0 Add zero-copy span access: Get_Read_Spans / Get_Write_Spans / Commit_Write
+ * 2026.10.16 v1.27.0 Add Ring_Buffer_Transfer, buffer to buffer copy through the spans without a staging array
+ * 2026.10.16 v1.27.1 Grow / shrink in place tell wrapped data without adding head and length, rings larger than 2 GB no longer overflow
 */
 
 #include "ring_buffer.h"
+#include "ring_buffer_probes.h"
 
 /**
  * \brief Initialization new buffer
@@ -31,9 +44,17 @@ uint8_t Ring_Buffer_Init(ring_buffer *ring_buffer_handle, uint8_t *buffer_addr,
 {
     ring_buffer_handle->head = 0;                 //Reset head pointer
     ring_buffer_handle->tail = 0;                 //Reset tail pointer
+#ifndef RING_BUFFER_EMPTY_SLOT
     ring_buffer_handle->lenght = 0;               //Reset has stored data length
+#endif
     ring_buffer_handle->array_addr = buffer_addr; //Buffer storage number base address
     ring_buffer_handle->max_length = buffer_size; //Buffer maximum storage data amount
+#ifdef RING_BUFFER_STATS
+    Ring_Buffer_Reset_Stats(ring_buffer_handle); //Reset operation counters
+#endif
+#ifdef RING_BUFFER_TRACE
+    ring_buffer_handle->trace = NULL; //Not traced until Ring_Buffer_Trace_Attach
+#endif
     if (ring_buffer_handle->max_length < 2)       //Buffer arrays must have two elements or more
         return RING_BUFFER_ERROR;                 //The buffer array is too small, the queue initialization failed
     else
@@ -48,17 +69,19 @@ uint8_t Ring_Buffer_Init(ring_buffer *ring_buffer_handle, uint8_t *buffer_addr,
  *      \arg RING_BUFFER_SUCCESS: successfully deleted
  *      \arg RING_BUFFER_ERROR: failed to delete
 */
-uint8_t Ring_Buffer_Delete(ring_buffer *ring_buffer_handle, uint8_t lenght)
+uint8_t Ring_Buffer_Delete(ring_buffer *ring_buffer_handle, uint32_t lenght)
 {
-    if (ring_buffer_handle->lenght < lenght)
+    if (RING_BUFFER_LENGTH(ring_buffer_handle) < lenght)
         return RING_BUFFER_ERROR; //The amount of data that has been stored is less than the amount of data that needs to be deleted.
     else
     {
-        if ((ring_buffer_handle->head + lenght) >= ring_buffer_handle->max_length)
+        if (lenght >= ring_buffer_handle->max_length - ring_buffer_handle->head) //Compare without adding, head + lenght can exceed 32 bits
             ring_buffer_handle->head = lenght - (ring_buffer_handle->max_length - ring_buffer_handle->head);
         else
             ring_buffer_handle->head += lenght; //Head pointer advances forward, abandon data
-        ring_buffer_handle->lenght -= lenght;   //Record the valid data length
+        RING_BUFFER_LENGTH_SUB(ring_buffer_handle, lenght); //Record the valid data length
+        RING_BUFFER_STATS_READ(ring_buffer_handle, lenght, 0);
+        RING_BUFFER_TRACE_READ(ring_buffer_handle, lenght);
         return RING_BUFFER_SUCCESS;             //The amount of data that has been stored is less than the amount of data that needs to be deleted.
     }
 }
@@ -74,17 +97,23 @@ uint8_t Ring_Buffer_Delete(ring_buffer *ring_buffer_handle, uint8_t lenght)
 uint8_t Ring_Buffer_Write_Byte(ring_buffer *ring_buffer_handle, uint8_t rb_data)
 {
     //The array of buffers is full, resulting in an overlay error
-    if (ring_buffer_handle->lenght == (ring_buffer_handle->max_length - 1))
+    if (RING_BUFFER_LENGTH(ring_buffer_handle) >= RING_BUFFER_CAPACITY(ring_buffer_handle))
+    {
+        RING_BUFFER_STATS_REJECT(ring_buffer_handle);
+        RING_BUFFER_PROBE(write_full, ring_buffer_handle, 1);
         return RING_BUFFER_ERROR;
+    }
     else
     {
         *(ring_buffer_handle->array_addr + ring_buffer_handle->tail) = rb_data; //Base site + offset, storage data
-        ring_buffer_handle->lenght++;                                           //Data quantity count +1
+        RING_BUFFER_LENGTH_ADD(ring_buffer_handle, 1);                          //Data quantity count +1
         ring_buffer_handle->tail++;                                             //Tail pointing
     }
     //If the tail pointer beyond the end of the array, the tail pointer points to the beginning of the buffer array, forming a closed loop.
     if (ring_buffer_handle->tail > (ring_buffer_handle->max_length - 1))
         ring_buffer_handle->tail = 0;
+    RING_BUFFER_STATS_WRITE(ring_buffer_handle, 1, 0);
+    RING_BUFFER_TRACE_WRITE(ring_buffer_handle, 1);
     return RING_BUFFER_SUCCESS;
 }
 
@@ -95,16 +124,20 @@ uint8_t Ring_Buffer_Write_Byte(ring_buffer *ring_buffer_handle, uint8_t rb_data)
 */
 uint8_t Ring_Buffer_Read_Byte(ring_buffer *ring_buffer_handle)
 {
-    uint8_t rb_data;
-    if (ring_buffer_handle->lenght != 0) //Data is not read
+    uint8_t rb_data = 0; //Returned as 0 when the buffer is empty
+    if (RING_BUFFER_LENGTH(ring_buffer_handle) != 0) //Data is not read
     {
         rb_data = *(ring_buffer_handle->array_addr + ring_buffer_handle->head); //Read data
         ring_buffer_handle->head++;
-        ring_buffer_handle->lenght--; //Data quantity count -1
+        RING_BUFFER_LENGTH_SUB(ring_buffer_handle, 1); //Data quantity count -1
         //If the head pointer exceeds the end of the array, the head pointer points to the beginning of the array, forming a closed loop.
         if (ring_buffer_handle->head > (ring_buffer_handle->max_length - 1))
             ring_buffer_handle->head = 0;
+        RING_BUFFER_STATS_READ(ring_buffer_handle, 1, 0);
+        RING_BUFFER_TRACE_READ(ring_buffer_handle, 1);
     }
+    else
+        RING_BUFFER_PROBE(read_empty, ring_buffer_handle, 1);
     return rb_data;
 }
 
@@ -119,9 +152,14 @@ uint8_t Ring_Buffer_Read_Byte(ring_buffer *ring_buffer_handle)
 */
 uint8_t Ring_Buffer_Write_String(ring_buffer *ring_buffer_handle, void *input_addr, uint32_t write_lenght)
 {
+    RING_BUFFER_PROBE(write_string_entry, ring_buffer_handle, write_lenght);
     //If you are not enough to store new data, return an error
-    if ((ring_buffer_handle->lenght + write_lenght) > (ring_buffer_handle->max_length))
+    if (write_lenght > RING_BUFFER_CAPACITY(ring_buffer_handle) - RING_BUFFER_LENGTH(ring_buffer_handle))
+    {
+        RING_BUFFER_STATS_REJECT(ring_buffer_handle);
+        RING_BUFFER_PROBE(write_full, ring_buffer_handle, write_lenght);
         return RING_BUFFER_ERROR;
+    }
     else
     {
         //Set two write lengths
@@ -141,19 +179,22 @@ uint8_t Ring_Buffer_Write_String(ring_buffer *ring_buffer_handle, void *input_ad
         if (write_size_b != 0) //Need to write twice
         {
             //Copy A, B data to the storage array, respectively
-            memcpy(ring_buffer_handle->array_addr + ring_buffer_handle->tail, input_addr, write_size_a);
-            memcpy(ring_buffer_handle->array_addr, input_addr + write_size_a, write_size_b);
-            ring_buffer_handle->lenght += write_lenght; //How much data is recorded
+            RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr + ring_buffer_handle->tail, input_addr, write_size_a);
+            RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr, input_addr + write_size_a, write_size_b);
+            RING_BUFFER_LENGTH_ADD(ring_buffer_handle, write_lenght); //How much data is recorded
             ring_buffer_handle->tail = write_size_b;    //Repositioning the tail pointer position
         }
         else //只需写入一次
         {
-            memcpy(ring_buffer_handle->array_addr + ring_buffer_handle->tail, input_addr, write_size_a);
-            ring_buffer_handle->lenght += write_lenght; //How much data is recorded
+            RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr + ring_buffer_handle->tail, input_addr, write_size_a);
+            RING_BUFFER_LENGTH_ADD(ring_buffer_handle, write_lenght); //How much data is recorded
             ring_buffer_handle->tail += write_size_a;   //Repositioning the tail pointer position
             if (ring_buffer_handle->tail == ring_buffer_handle->max_length)
                 ring_buffer_handle->tail = 0; //If the write data is written, it is just written to the end of the array, it will return to the beginning and prevent the offside.
         }
+        RING_BUFFER_STATS_WRITE(ring_buffer_handle, write_lenght, write_size_b != 0);
+        RING_BUFFER_TRACE_WRITE(ring_buffer_handle, write_lenght);
+        RING_BUFFER_PROBE(write_string_return, ring_buffer_handle, write_lenght);
         return RING_BUFFER_SUCCESS;
     }
 }
@@ -169,8 +210,12 @@ uint8_t Ring_Buffer_Write_String(ring_buffer *ring_buffer_handle, void *input_ad
 */
 uint8_t Ring_Buffer_Read_String(ring_buffer *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght)
 {
-    if (read_lenght > ring_buffer_handle->lenght)
+    RING_BUFFER_PROBE(read_string_entry, ring_buffer_handle, read_lenght);
+    if (read_lenght > RING_BUFFER_LENGTH(ring_buffer_handle))
+    {
+        RING_BUFFER_PROBE(read_empty, ring_buffer_handle, read_lenght);
         return RING_BUFFER_ERROR;
+    }
     else
     {
         uint32_t Read_size_a, Read_size_b;
@@ -186,19 +231,22 @@ uint8_t Ring_Buffer_Read_String(ring_buffer *ring_buffer_handle, uint8_t *output
         }
         if (Read_size_b != 0) //Need to read twice
         {
-            memcpy(output_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head, Read_size_a);
-            memcpy(output_addr + Read_size_a, ring_buffer_handle->array_addr, Read_size_b);
-            ring_buffer_handle->lenght -= read_lenght; //Record the amount of remaining data
+            RING_BUFFER_COPY_OUT(output_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head, Read_size_a);
+            RING_BUFFER_COPY_OUT(output_addr + Read_size_a, ring_buffer_handle->array_addr, Read_size_b);
+            RING_BUFFER_LENGTH_SUB(ring_buffer_handle, read_lenght); //Record the amount of remaining data
             ring_buffer_handle->head = Read_size_b;    //Repositioning head pointer position
         }
         else
         {
-            memcpy(output_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head, Read_size_a);
-            ring_buffer_handle->lenght -= read_lenght; //Record the amount of remaining data
+            RING_BUFFER_COPY_OUT(output_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head, Read_size_a);
+            RING_BUFFER_LENGTH_SUB(ring_buffer_handle, read_lenght); //Record the amount of remaining data
             ring_buffer_handle->head += Read_size_a;   //Repositioning head pointer position
             if (ring_buffer_handle->head == ring_buffer_handle->max_length)
                 ring_buffer_handle->head = 0; //If the head pointer is just written to the end of the array, it will return to the beginning to prevent the offside.
         }
+        RING_BUFFER_STATS_READ(ring_buffer_handle, read_lenght, Read_size_b != 0);
+        RING_BUFFER_TRACE_READ(ring_buffer_handle, read_lenght);
+        RING_BUFFER_PROBE(read_string_return, ring_buffer_handle, read_lenght);
         return RING_BUFFER_SUCCESS;
     }
 }
@@ -222,8 +270,8 @@ uint8_t Ring_Buffer_Insert_Keyword(ring_buffer *ring_buffer_handle, uint32_t key
     keyword_byte[1] = *(keyword_addr + 2);
     keyword_byte[2] = *(keyword_addr + 1);
     keyword_byte[3] = *(keyword_addr + 0);
-    //Fill keywords in ring buffer
-    return Ring_Buffer_Write_String(ring_buffer_handle, keyword_byte, keyword_lenght);
+    //Fill keywords in ring buffer, the low keyword_lenght bytes are the ones Ring_Buffer_Find_Keyword looks for
+    return Ring_Buffer_Write_String(ring_buffer_handle, keyword_byte + (4 - keyword_lenght), keyword_lenght);
 #else
     //Large end mode word sequence arrangement
     keyword_byte[0] = *(keyword_addr + 0);
@@ -231,7 +279,7 @@ uint8_t Ring_Buffer_Insert_Keyword(ring_buffer *ring_buffer_handle, uint32_t key
     keyword_byte[2] = *(keyword_addr + 2);
     keyword_byte[3] = *(keyword_addr + 3);
     //Fill keywords in ring buffer
-    return Ring_Buffer_Write_String(ring_buffer_handle, keyword_byte + (keyword_lenght - 1), keyword_lenght);
+    return Ring_Buffer_Write_String(ring_buffer_handle, keyword_byte + (4 - keyword_lenght), keyword_lenght);
 #endif
 }
 
@@ -244,19 +292,48 @@ uint8_t Ring_Buffer_Insert_Keyword(ring_buffer *ring_buffer_handle, uint32_t key
 */
 uint32_t Ring_Buffer_Find_Keyword(ring_buffer *ring_buffer_handle, uint32_t keyword, uint8_t keyword_lenght)
 {
-    uint32_t max_find_lenght = ring_buffer_handle->lenght - keyword_lenght + 1; //Calculate the maximum length that needs to be searched
+    uint32_t lenght = RING_BUFFER_LENGTH(ring_buffer_handle);                   //Saved data volume
+    uint32_t max_find_lenght = lenght - keyword_lenght + 1;                     //Calculate the maximum length that needs to be searched
     uint8_t trigger_word = keyword >> ((keyword_lenght - 1) * 8);               //Calculate bytes (highest) to trigger keyword check
-    uint32_t distance = 1, find_head = ring_buffer_handle->head;                //Record keyword distance head pointer length / temporary head pointer gets the original pointer initial value
-    while (distance <= max_find_lenght)                                         //Search for keywords within the setting range (prevent pointer offside errors)
+    uint32_t searched = 0, find_head = ring_buffer_handle->head;                //Bytes already checked from the head pointer / temporary head pointer gets the original pointer initial value
+    uint32_t span, distance;
+    const uint8_t *found;
+    RING_BUFFER_PROBE(find_keyword_entry, ring_buffer_handle, keyword_lenght);
+    if (lenght < keyword_lenght) //Less data than the keyword, max_find_lenght would wrap around
     {
-        if (*(ring_buffer_handle->array_addr + find_head) == trigger_word)                      //If the high byte match begins to check to the low position
+        RING_BUFFER_PROBE(find_keyword_return, ring_buffer_handle, 0);
+        return RING_BUFFER_ERROR;
+    }
+    while (searched < max_find_lenght)                                          //Search for keywords within the setting range (prevent pointer offside errors)
+    {
+        //Look for the trigger byte in the contiguous part up to the end of the array, at most two spans per lap
+        span = ring_buffer_handle->max_length - find_head;
+        if (span > max_find_lenght - searched)
+            span = max_find_lenght - searched;
+        found = RING_BUFFER_FIND_BYTE(ring_buffer_handle->array_addr + find_head, trigger_word, span);
+        if (found == NULL)
+        {
+            searched += span; //No trigger byte in this span
+            find_head += span;
+        }
+        else
+        {
+            distance = searched + (uint32_t)(found - (ring_buffer_handle->array_addr + find_head)) + 1;
+            find_head = (uint32_t)(found - ring_buffer_handle->array_addr);
             if (Ring_Buffer_Get_Word(ring_buffer_handle, find_head, keyword_lenght) == keyword) //Meet keyword match
-                return distance;                                                                //Return the length, use Ring_Buffer_Read_String to extract data
-        find_head++;                                                                            //The current character does not match, the temporary head pointer is moved, check the next one
-        distance++;                                                                             //The length also has to move after search
+            {
+                RING_BUFFER_STATS_SCAN(ring_buffer_handle, distance);
+                RING_BUFFER_PROBE(find_keyword_return, ring_buffer_handle, distance);
+                return distance; //Return the length, use Ring_Buffer_Read_String to extract data
+            }
+            searched = distance; //The high byte matched but the low bytes did not, continue after it
+            find_head++;
+        }
         if (find_head > (ring_buffer_handle->max_length - 1))
             find_head = 0; //If you go to the end of the array, return the beginning of the array (ring buffering characteristics)
     }
+    RING_BUFFER_STATS_SCAN(ring_buffer_handle, max_find_lenght);
+    RING_BUFFER_PROBE(find_keyword_return, ring_buffer_handle, 0);
     return RING_BUFFER_ERROR; //I found it
 }
 
@@ -273,7 +350,7 @@ static uint32_t Ring_Buffer_Get_Word(ring_buffer *ring_buffer_handle, uint32_t h
     for (i = 1; i <= read_lenght; i++) //Extract data backwards according to the length of keyword (number of characters)
     {
         //From the highest bit to the lowest position, integrate into a 32-bit data
-        rb_data |= *(ring_buffer_handle->array_addr + head) << (8 * (read_lenght - i));
+        rb_data |= (uint32_t)*(ring_buffer_handle->array_addr + head) << (8 * (read_lenght - i));
         head++;
         if (head > (ring_buffer_handle->max_length - 1))
             head = 0; //If you go to the end of the array, return the beginning of the array (ring buffering characteristics)
@@ -288,7 +365,7 @@ static uint32_t Ring_Buffer_Get_Word(ring_buffer *ring_buffer_handle, uint32_t h
 */
 uint32_t Ring_Buffer_Get_Length(ring_buffer *ring_buffer_handle)
 {
-    return ring_buffer_handle->lenght;
+    return RING_BUFFER_LENGTH(ring_buffer_handle);
 }
 
 /**
@@ -298,5 +375,286 @@ uint32_t Ring_Buffer_Get_Length(ring_buffer *ring_buffer_handle)
 */
 uint32_t Ring_Buffer_Get_FreeSize(ring_buffer *ring_buffer_handle)
 {
-    return (ring_buffer_handle->max_length - ring_buffer_handle->lenght);
-}
\ No newline at end of file
+    return (RING_BUFFER_CAPACITY(ring_buffer_handle) - RING_BUFFER_LENGTH(ring_buffer_handle));
+}
+
+/**
+ * \brief Get the stored data in place, as the part up to the end of the array and the part from its beginning
+ * \details Nothing is copied and nothing is removed, use Ring_Buffer_Delete after processing the data;
+ * The spans stay valid until the data is deleted or read
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] span: Two spans, span[0] from the head pointer, span[1] from the beginning of the array (lenght 0 when not wrapped)
+ * \return Returns the amount of data already stored in the buffer (span[0].lenght + span[1].lenght)
+*/
+uint32_t Ring_Buffer_Get_Read_Spans(ring_buffer *ring_buffer_handle, ring_buffer_span *span)
+{
+    uint32_t lenght = RING_BUFFER_LENGTH(ring_buffer_handle);
+    uint32_t size_a = ring_buffer_handle->max_length - ring_buffer_handle->head; //From the head pointer to the end of the array
+    if (size_a > lenght)
+        size_a = lenght;
+    span[0].addr = ring_buffer_handle->array_addr + ring_buffer_handle->head;
+    span[0].lenght = size_a;
+    span[1].addr = ring_buffer_handle->array_addr;
+    span[1].lenght = lenght - size_a;
+    return lenght;
+}
+
+/**
+ * \brief Get the free space in place, to be filled directly (e.g. by DMA or a decoder) and then committed
+ * \details Fill span[0] before span[1], then commit the number of bytes filled with Ring_Buffer_Commit_Write
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] span: Two spans, span[0] from the tail pointer, span[1] from the beginning of the array (lenght 0 when not wrapped)
+ * \return Return to buffer available storage space (span[0].lenght + span[1].lenght)
+*/
+uint32_t Ring_Buffer_Get_Write_Spans(ring_buffer *ring_buffer_handle, ring_buffer_span *span)
+{
+    uint32_t lenght = RING_BUFFER_CAPACITY(ring_buffer_handle) - RING_BUFFER_LENGTH(ring_buffer_handle);
+    uint32_t size_a = ring_buffer_handle->max_length - ring_buffer_handle->tail; //From the tail pointer to the end of the array
+    if (size_a > lenght)
+        size_a = lenght;
+    span[0].addr = ring_buffer_handle->array_addr + ring_buffer_handle->tail;
+    span[0].lenght = size_a;
+    span[1].addr = ring_buffer_handle->array_addr;
+    span[1].lenght = lenght - size_a;
+    return lenght;
+}
+
+/**
+ * \brief Add the data filled in through Ring_Buffer_Get_Write_Spans to the buffer, the tail pointer just moves, nothing is copied
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] lenght: Number of bytes filled in
+ * \return Return the result of the commit
+ *      \arg RING_BUFFER_SUCCESS: Commit success
+ *      \arg RING_BUFFER_ERROR: Commit failure, more than the free space
+*/
+uint8_t Ring_Buffer_Commit_Write(ring_buffer *ring_buffer_handle, uint32_t lenght)
+{
+    if (lenght > RING_BUFFER_CAPACITY(ring_buffer_handle) - RING_BUFFER_LENGTH(ring_buffer_handle))
+        return RING_BUFFER_ERROR;
+    if (lenght >= ring_buffer_handle->max_length - ring_buffer_handle->tail) //Compare without adding, tail + lenght can exceed 32 bits
+        ring_buffer_handle->tail = lenght - (ring_buffer_handle->max_length - ring_buffer_handle->tail);
+    else
+        ring_buffer_handle->tail += lenght;
+    RING_BUFFER_LENGTH_ADD(ring_buffer_handle, lenght); //How much data is recorded
+    //Filled across the end of the array when the new tail pointer is inside the data just committed
+    RING_BUFFER_STATS_WRITE(ring_buffer_handle, lenght, ring_buffer_handle->tail != 0 && ring_buffer_handle->tail < lenght);
+    RING_BUFFER_TRACE_WRITE(ring_buffer_handle, lenght);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Move data from one buffer to another, as much as the source holds and the destination has room for
+ * \details Copied from the source spans to the destination spans directly (at most three memcpy), no staging array;
+ * Removed from the source and added to the destination like Ring_Buffer_Delete / Ring_Buffer_Commit_Write
+ * \param[out] input_handle: Source buffer structure
+ * \param[out] output_handle: Destination buffer structure, must not be the source
+ * \return Returns the number of bytes moved, 0: nothing to move or no room
+*/
+uint32_t Ring_Buffer_Transfer(ring_buffer *input_handle, ring_buffer *output_handle)
+{
+    ring_buffer_span input[2], output[2];
+    uint32_t lenght = Ring_Buffer_Get_Read_Spans(input_handle, input);
+    uint32_t space = Ring_Buffer_Get_Write_Spans(output_handle, output);
+    uint32_t moved = 0, input_pos = 0, output_pos = 0, size;
+    uint8_t i = 0, o = 0;
+    if (input_handle == output_handle)
+        return 0;
+    if (lenght > space)
+        lenght = space;
+    while (moved < lenght)
+    {
+        //Copy up to the nearest end of a source span, a destination span or the data
+        size = lenght - moved;
+        if (size > input[i].lenght - input_pos)
+            size = input[i].lenght - input_pos;
+        if (size > output[o].lenght - output_pos)
+            size = output[o].lenght - output_pos;
+        RING_BUFFER_COPY_IN(output[o].addr + output_pos, input[i].addr + input_pos, size);
+        moved += size;
+        input_pos += size;
+        output_pos += size;
+        if (input_pos == input[i].lenght) //Source wraps to the beginning of its array
+        {
+            i++;
+            input_pos = 0;
+        }
+        if (output_pos == output[o].lenght) //Destination wraps to the beginning of its array
+        {
+            o++;
+            output_pos = 0;
+        }
+    }
+    if (lenght != 0)
+    {
+        Ring_Buffer_Delete(input_handle, lenght);
+        Ring_Buffer_Commit_Write(output_handle, lenght);
+    }
+    return lenght;
+}
+
+/**
+ * \brief Move the buffer to a new array of a different size, stored data is kept
+ * \details Data is copied once into the new array starting at offset 0 (at most two memcpy), the old array is no longer used
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] buffer_addr: New array of external definitions, must not overlap the old one
+ * \param[in] buffer_size: New array space
+ * \return Returns the result of the resize
+ *      \arg RING_BUFFER_SUCCESS: Resize success
+ *      \arg RING_BUFFER_ERROR: Resize failure, the new array is too small for the stored data, nothing is changed
+*/
+uint8_t Ring_Buffer_Resize(ring_buffer *ring_buffer_handle, uint8_t *buffer_addr, uint32_t buffer_size)
+{
+    uint32_t lenght = RING_BUFFER_LENGTH(ring_buffer_handle);
+    uint32_t size_a = ring_buffer_handle->max_length - ring_buffer_handle->head; //From the head pointer to the end of the old array
+    if (buffer_size < 2 || lenght > buffer_size - RING_BUFFER_RESERVED)
+        return RING_BUFFER_ERROR;
+    if (size_a >= lenght) //Copy both parts in order into the new array
+        memcpy(buffer_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head, lenght);
+    else
+    {
+        memcpy(buffer_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head, size_a);
+        memcpy(buffer_addr + size_a, ring_buffer_handle->array_addr, lenght - size_a);
+    }
+    ring_buffer_handle->array_addr = buffer_addr;
+    ring_buffer_handle->max_length = buffer_size;
+    ring_buffer_handle->head = 0;
+    ring_buffer_handle->tail = (lenght == buffer_size) ? 0 : lenght;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Grow the buffer in place after its array was extended (realloc / mremap keep the old bytes)
+ * \details If the stored data wraps, only the shorter part is moved, so the new space sits between tail and head
+ * \param[out] ring_buffer_handle: Buffer structure, array_addr must already point to the extended array
+ * \param[in] buffer_size: New array space, not smaller than the old one
+ * \return Returns the result of the grow
+ *      \arg RING_BUFFER_SUCCESS: Grow success
+ *      \arg RING_BUFFER_ERROR: Grow failure, the new size is smaller than the old one
+*/
+uint8_t Ring_Buffer_Grow_In_Place(ring_buffer *ring_buffer_handle, uint32_t buffer_size)
+{
+    uint32_t old_size = ring_buffer_handle->max_length;
+    uint32_t head = ring_buffer_handle->head, lenght = RING_BUFFER_LENGTH(ring_buffer_handle);
+    if (buffer_size < old_size)
+        return RING_BUFFER_ERROR;
+    if (lenght == 0)
+    {
+        ring_buffer_handle->head = 0;
+        ring_buffer_handle->tail = 0;
+    }
+    else if (lenght <= old_size - head) //Data is continuous (no head + lenght, it can overflow beyond 2 GB), the new space simply follows it
+        ring_buffer_handle->tail = (lenght == buffer_size - head) ? 0 : head + lenght;
+    else //Data wraps: part A is [head, old end), part B is [0, tail)
+    {
+        uint32_t size_a = old_size - head, size_b = ring_buffer_handle->tail;
+        if (size_b <= buffer_size - old_size && size_b < size_a)
+        {
+            //Part B is shorter and fits in the new space, append it after part A
+            memcpy(ring_buffer_handle->array_addr + old_size, ring_buffer_handle->array_addr, size_b);
+            ring_buffer_handle->tail = (old_size + size_b == buffer_size) ? 0 : old_size + size_b;
+        }
+        else
+        {
+            //Move part A to the end of the new array
+            memmove(ring_buffer_handle->array_addr + buffer_size - size_a, ring_buffer_handle->array_addr + head, size_a);
+            ring_buffer_handle->head = buffer_size - size_a;
+        }
+    }
+    ring_buffer_handle->max_length = buffer_size;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Shrink the buffer in place, the data is compacted into the first buffer_size bytes before the array is reduced
+ * \details At most one memmove, afterwards the caller may realloc / mremap the array down to buffer_size
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] buffer_size: New array space, not larger than the old one and not smaller than the stored data
+ * \return Returns the result of the shrink
+ *      \arg RING_BUFFER_SUCCESS: Shrink success
+ *      \arg RING_BUFFER_ERROR: Shrink failure, nothing is changed
+*/
+uint8_t Ring_Buffer_Shrink_In_Place(ring_buffer *ring_buffer_handle, uint32_t buffer_size)
+{
+    uint32_t old_size = ring_buffer_handle->max_length;
+    uint32_t head = ring_buffer_handle->head, lenght = RING_BUFFER_LENGTH(ring_buffer_handle);
+    if (buffer_size < 2 || buffer_size > old_size || lenght > buffer_size - RING_BUFFER_RESERVED)
+        return RING_BUFFER_ERROR;
+    if (lenght == 0)
+    {
+        ring_buffer_handle->head = 0;
+        ring_buffer_handle->tail = 0;
+    }
+    else if (lenght <= old_size - head) //Data is continuous (no head + lenght, it can overflow beyond 2 GB)
+    {
+        if (head > buffer_size || lenght > buffer_size - head) //It ends beyond the new size, move it to the beginning
+        {
+            memmove(ring_buffer_handle->array_addr, ring_buffer_handle->array_addr + head, lenght);
+            ring_buffer_handle->head = 0;
+            head = 0;
+        }
+        ring_buffer_handle->tail = (lenght == buffer_size - head) ? 0 : head + lenght;
+    }
+    else //Data wraps, move part A down so that it ends at the new size, part B stays at the beginning
+    {
+        uint32_t size_a = old_size - head;
+        memmove(ring_buffer_handle->array_addr + buffer_size - size_a, ring_buffer_handle->array_addr + head, size_a);
+        ring_buffer_handle->head = buffer_size - size_a;
+    }
+    ring_buffer_handle->max_length = buffer_size;
+    return RING_BUFFER_SUCCESS;
+}
+
+#ifdef RING_BUFFER_STATS
+/**
+ * \brief Record an operation in the counters (called by the ring buffer functions through RING_BUFFER_STATS_xxx)
+ * \details The occupancy is weighted by the ticks it was held, the saved data volume before this operation
+ * is added for the ticks since the previous update, so a buffer sitting nearly full for a long time shows a high average
+ * \param[out] ring_buffer_handle: Buffer structure, data volume already updated by the operation
+ * \param[in] bytes_in: Bytes written
+ * \param[in] bytes_out: Bytes read or deleted
+ * \param[in] split: The copy was split in two by the end of the array
+*/
+void Ring_Buffer_Stats_Update(ring_buffer *ring_buffer_handle, uint32_t bytes_in, uint32_t bytes_out, uint8_t split)
+{
+    ring_buffer_stats *stats = &ring_buffer_handle->stats;
+#ifdef RING_BUFFER_STATS_CLOCK
+    uint32_t tick = (uint32_t)RING_BUFFER_STATS_CLOCK();
+#else
+    uint32_t tick = stats->last_tick + 1; //No clock source, every operation counts as one tick
+#endif
+    uint32_t elapsed = tick - stats->last_tick; //Unsigned difference survives the tick counter wrapping
+    stats->occupancy_sum += (uint64_t)stats->last_lenght * elapsed;
+    stats->occupancy_time += elapsed;
+    stats->last_tick = tick;
+    stats->last_lenght = RING_BUFFER_LENGTH(ring_buffer_handle);
+    stats->bytes_in += bytes_in;
+    stats->bytes_out += bytes_out;
+    stats->split_copy += split;
+    if (stats->last_lenght > stats->high_water)
+        stats->high_water = stats->last_lenght;
+}
+
+/**
+ * \brief Get a snapshot of the operation counters
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] stats: Counters copy
+*/
+void Ring_Buffer_Get_Stats(ring_buffer *ring_buffer_handle, ring_buffer_stats *stats)
+{
+    *stats = ring_buffer_handle->stats;
+}
+
+/**
+ * \brief Clear the operation counters, the occupancy restarts from the current data volume
+ * \param[out] ring_buffer_handle: Buffer structure
+*/
+void Ring_Buffer_Reset_Stats(ring_buffer *ring_buffer_handle)
+{
+    memset(&ring_buffer_handle->stats, 0, sizeof(ring_buffer_stats));
+#ifdef RING_BUFFER_STATS_CLOCK
+    ring_buffer_handle->stats.last_tick = (uint32_t)RING_BUFFER_STATS_CLOCK();
+#endif
+    ring_buffer_handle->stats.last_lenght = RING_BUFFER_LENGTH(ring_buffer_handle);
+    ring_buffer_handle->stats.high_water = ring_buffer_handle->stats.last_lenght;
+}
+#endif
\ No newline at end of file
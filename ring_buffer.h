@@ -2,8 +2,8 @@
  * \file ring_buffer.h
  * \brief Simple ring buffer correlation definition and statement
  * \author netube_99\netube@163.com
- * \date 2021.01.30
- * \version v1.3.1
+ * \date 2026.10.16
+ * \version v1.27.0
 */
 
 #ifndef _RING_BUFFER_H_
@@ -16,18 +16,116 @@
 #define RING_BUFFER_SUCCESS         0x01
 #define RING_BUFFER_ERROR           0x00
 
+// Full detection, both let every read / write function use the same capacity
+// Default: the saved data volume is counted, the whole array can be filled (capacity = buffer size)
+// Define RING_BUFFER_EMPTY_SLOT: full / empty come from the pointers alone, no counter is updated on each operation,
+// one byte of the array always stays empty to tell full from empty (capacity = buffer size - 1)
+#ifdef RING_BUFFER_EMPTY_SLOT
+#define RING_BUFFER_RESERVED        1
+#else
+#define RING_BUFFER_RESERVED        0
+#endif
+
+// Define RING_BUFFER_STATS to count ring operations, nothing is compiled in when it is not defined
+// Define RING_BUFFER_STATS_CLOCK() as a free-running tick source (e.g. HAL_GetTick()) for time-weighted occupancy,
+// otherwise every operation counts as one tick
+#ifdef RING_BUFFER_STATS
+// Ring buffer operation counters
+typedef struct
+{
+    uint64_t bytes_in;       //Bytes written
+    uint64_t bytes_out;      //Bytes read or deleted
+    uint32_t write_reject;   //Writes refused because the buffer was full
+    uint32_t high_water;     //Highest saved data volume
+    uint32_t split_copy;     //String reads / writes split in two copies by the end of the array
+    uint64_t keyword_scan;   //Bytes scanned by keyword searches
+    uint64_t occupancy_sum;  //Sum of saved data volume x ticks, divide by occupancy_time for the average
+    uint64_t occupancy_time; //Ticks covered by occupancy_sum
+    uint32_t last_tick;      //Tick of the last update
+    uint32_t last_lenght;    //Saved data volume since the last update
+} ring_buffer_stats;
+#endif
+
 // Ring buffer structure
 typedef struct
 {
     uint32_t head;       //Operating head pointer
     uint32_t tail;       //Operate tail pointer
+#ifndef RING_BUFFER_EMPTY_SLOT
     uint32_t lenght;     //Saved data volume
+#endif
     uint8_t *array_addr; //Buffer storage number base address
     uint32_t max_length; //Buffer maximum storage data amount
+#ifdef RING_BUFFER_STATS
+    ring_buffer_stats stats; //Operation counters
+#endif
+#ifdef RING_BUFFER_TRACE
+    struct ring_buffer_trace *trace; //Occupancy / latency histograms, NULL: not traced (see ring_buffer_trace.h)
+#endif
 } ring_buffer;
 
+// Contiguous part of a buffer array, the data of a buffer is at most two spans (up to the end of the array, then from its beginning)
+typedef struct
+{
+    uint8_t *addr;   //Start of the span in the buffer array
+    uint32_t lenght; //Number of bytes
+} ring_buffer_span;
+
+// Saved data volume / usable capacity of a buffer, for the functions that work on the structure directly
+#ifdef RING_BUFFER_EMPTY_SLOT
+#define RING_BUFFER_LENGTH(handle)              ((handle)->tail >= (handle)->head ? (handle)->tail - (handle)->head : (handle)->max_length - (handle)->head + (handle)->tail)
+#define RING_BUFFER_LENGTH_ADD(handle, size)    ((void)0)
+#define RING_BUFFER_LENGTH_SUB(handle, size)    ((void)0)
+#else
+#define RING_BUFFER_LENGTH(handle)              ((handle)->lenght)
+#define RING_BUFFER_LENGTH_ADD(handle, size)    ((handle)->lenght += (size))
+#define RING_BUFFER_LENGTH_SUB(handle, size)    ((handle)->lenght -= (size))
+#endif
+#define RING_BUFFER_CAPACITY(handle)            ((handle)->max_length - RING_BUFFER_RESERVED)
+
+#ifdef RING_BUFFER_STATS
+void Ring_Buffer_Stats_Update(ring_buffer *ring_buffer_handle, uint32_t bytes_in, uint32_t bytes_out, uint8_t split); //Record an operation (used by the ring buffer functions)
+void Ring_Buffer_Get_Stats(ring_buffer *ring_buffer_handle, ring_buffer_stats *stats);                               //Get a snapshot of the counters
+void Ring_Buffer_Reset_Stats(ring_buffer *ring_buffer_handle);                                                       //Clear the counters
+#define RING_BUFFER_STATS_WRITE(handle, lenght, split)  Ring_Buffer_Stats_Update((handle), (lenght), 0, (split))
+#define RING_BUFFER_STATS_READ(handle, lenght, split)   Ring_Buffer_Stats_Update((handle), 0, (lenght), (split))
+#define RING_BUFFER_STATS_REJECT(handle)                ((handle)->stats.write_reject++)
+#define RING_BUFFER_STATS_SCAN(handle, lenght)          ((handle)->stats.keyword_scan += (lenght))
+#else
+#define RING_BUFFER_STATS_WRITE(handle, lenght, split)  ((void)0)
+#define RING_BUFFER_STATS_READ(handle, lenght, split)   ((void)0)
+#define RING_BUFFER_STATS_REJECT(handle)                ((void)0)
+#define RING_BUFFER_STATS_SCAN(handle, lenght)          ((void)0)
+#endif
+
+// Define RING_BUFFER_NT_COPY to send the string read / write copies and the keyword scan through ring_buffer_copy.c
+// (non-temporal stores / prefetch for large transfers, SIMD kernels picked at load time), otherwise memcpy / memchr
+#ifdef RING_BUFFER_NT_COPY
+void Ring_Buffer_Copy_In(void *output_addr, const void *input_addr, size_t lenght);              //Copy data into a buffer array (ring_buffer_copy.c)
+void Ring_Buffer_Copy_Out(void *output_addr, const void *input_addr, size_t lenght);             //Copy data out of a buffer array (ring_buffer_copy.c)
+const uint8_t *Ring_Buffer_Copy_Find_Byte(const void *input_addr, uint8_t byte, size_t lenght); //Find a byte in contiguous data (ring_buffer_copy.c)
+#define RING_BUFFER_COPY_IN(output_addr, input_addr, lenght)    Ring_Buffer_Copy_In((output_addr), (input_addr), (lenght))
+#define RING_BUFFER_COPY_OUT(output_addr, input_addr, lenght)   Ring_Buffer_Copy_Out((output_addr), (input_addr), (lenght))
+#define RING_BUFFER_FIND_BYTE(input_addr, byte, lenght)         Ring_Buffer_Copy_Find_Byte((input_addr), (byte), (lenght))
+#else
+#define RING_BUFFER_COPY_IN(output_addr, input_addr, lenght)    memcpy((output_addr), (input_addr), (lenght))
+#define RING_BUFFER_COPY_OUT(output_addr, input_addr, lenght)   memcpy((output_addr), (input_addr), (lenght))
+#define RING_BUFFER_FIND_BYTE(input_addr, byte, lenght)         ((const uint8_t *)memchr((input_addr), (byte), (lenght)))
+#endif
+
+// Define RING_BUFFER_TRACE to compile in the histogram hooks, a buffer is traced after Ring_Buffer_Trace_Attach
+#ifdef RING_BUFFER_TRACE
+void Ring_Buffer_Trace_Write(ring_buffer *ring_buffer_handle, uint32_t lenght); //Record a write (used by the ring buffer functions)
+void Ring_Buffer_Trace_Read(ring_buffer *ring_buffer_handle, uint32_t lenght);  //Record a read (used by the ring buffer functions)
+#define RING_BUFFER_TRACE_WRITE(handle, lenght) do { if ((handle)->trace) Ring_Buffer_Trace_Write((handle), (lenght)); } while (0)
+#define RING_BUFFER_TRACE_READ(handle, lenght)  do { if ((handle)->trace) Ring_Buffer_Trace_Read((handle), (lenght)); } while (0)
+#else
+#define RING_BUFFER_TRACE_WRITE(handle, lenght) ((void)0)
+#define RING_BUFFER_TRACE_READ(handle, lenght)  ((void)0)
+#endif
+
 uint8_t Ring_Buffer_Init(ring_buffer *ring_buffer_handle, uint8_t *buffer_addr, uint32_t buffer_size);         //Initialization new buffer
-uint8_t Ring_Buffer_Delete(ring_buffer *ring_buffer_handle, uint8_t lenght);                                   //Delete data from the head pointer to the specified length
+uint8_t Ring_Buffer_Delete(ring_buffer *ring_buffer_handle, uint32_t lenght);                                  //Delete data from the head pointer to the specified length
 uint8_t Ring_Buffer_Write_Byte(ring_buffer *ring_buffer_handle, uint8_t rb_data);                              //Write a byte to the buffer
 uint8_t Ring_Buffer_Read_Byte(ring_buffer *ring_buffer_handle);                                                //Read a byte from the buffer
 uint8_t Ring_Buffer_Write_String(ring_buffer *ring_buffer_handle, void *input_addr, uint32_t write_lenght);    //Write the specified length data to the buffer
@@ -37,5 +135,12 @@ uint32_t Ring_Buffer_Find_Keyword(ring_buffer *ring_buffer_handle, uint32_t keyw
 static uint32_t Ring_Buffer_Get_Word(ring_buffer *ring_buffer_handle, uint32_t head, uint32_t read_lenght);    //Get the full length of the full length from the specified head pointer address (private function, no pointer-proof protection)
 uint32_t Ring_Buffer_Get_Length(ring_buffer *ring_buffer_handle);                                              //Get the data length that has been stored in the buffer
 uint32_t Ring_Buffer_Get_FreeSize(ring_buffer *ring_buffer_handle);                                            //Get a buffer available storage space
+uint32_t Ring_Buffer_Get_Read_Spans(ring_buffer *ring_buffer_handle, ring_buffer_span *span);                 //Get the stored data in place as two spans
+uint32_t Ring_Buffer_Get_Write_Spans(ring_buffer *ring_buffer_handle, ring_buffer_span *span);                //Get the free space in place as two spans
+uint8_t Ring_Buffer_Commit_Write(ring_buffer *ring_buffer_handle, uint32_t lenght);                            //Add the data filled in the write spans to the buffer
+uint32_t Ring_Buffer_Transfer(ring_buffer *input_handle, ring_buffer *output_handle);                         //Move data from one buffer to another without a staging array
+uint8_t Ring_Buffer_Resize(ring_buffer *ring_buffer_handle, uint8_t *buffer_addr, uint32_t buffer_size);       //Move the buffer to a new array of a different size, keep the data
+uint8_t Ring_Buffer_Grow_In_Place(ring_buffer *ring_buffer_handle, uint32_t buffer_size);                      //Grow the buffer after its array was extended in place
+uint8_t Ring_Buffer_Shrink_In_Place(ring_buffer *ring_buffer_handle, uint32_t buffer_size);                    //Compact the buffer before its array is reduced in place
 
 #endif
\ No newline at end of file
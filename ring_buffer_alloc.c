@@ -0,0 +1,242 @@
+/**
+ * \file ring_buffer_alloc.c
+ * \brief Ring buffer storage allocation helper implementation (Linux)
+ * \details For large capture rings the storage can be mapped on 2 MB / 1 GB huge pages to cut TLB misses,
+ * bound to the NUMA node of the capture thread to avoid cross-node traffic, and prefaulted so no page fault happens during capture;
+ * The allocated storage is handed to Ring_Buffer_Init, all the normal ring buffer functions work on it unchanged;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.2.2
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+ * 2026.10.16 v1.1.0 Add resize with mremap, contents are kept
+ * 2026.10.16 v1.2.0 Storage can be allocated alone with a size_t size, for ring_buffer_large
+ * 2026.10.16 v1.2.1 Resize binds and prefaults the added pages like the initial storage
+ * 2026.10.16 v1.2.2 Growing within a mapping kept by a refused shrink does not remap or place pages past its end
+*/
+
+#define _GNU_SOURCE
+#include "ring_buffer_alloc.h"
+
+#if defined(__linux__)
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+#define RING_BUFFER_MPOL_BIND 2 //MPOL_BIND from linux/mempolicy.h
+
+/**
+ * \brief Map anonymous storage of the specified page type (private function)
+ * \param[out] mem: Mapping record
+ * \param[in] buffer_size: Storage size needed
+ * \param[in] page_type: RING_BUFFER_PAGE_xxx
+ * \return Return the mapping result
+ *      \arg RING_BUFFER_SUCCESS: Map success
+ *      \arg RING_BUFFER_ERROR: Map failure
+*/
+static uint8_t Ring_Buffer_Alloc_Map(ring_buffer_mem *mem, size_t buffer_size, uint8_t page_type)
+{
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS; //No MAP_NORESERVE, hugetlb must fail here instead of SIGBUS on first touch
+    void *addr;
+    if (page_type == RING_BUFFER_PAGE_HUGE_2M)
+    {
+        page_size = (size_t)1 << 21;
+        flags |= MAP_HUGETLB | MAP_HUGE_2MB;
+    }
+    else if (page_type == RING_BUFFER_PAGE_HUGE_1G)
+    {
+        page_size = (size_t)1 << 30;
+        flags |= MAP_HUGETLB | MAP_HUGE_1GB;
+    }
+    else if (page_type == RING_BUFFER_PAGE_THP)
+        page_size = (size_t)1 << 21; //Round to the huge page size so the whole range can be backed by huge pages
+    mem->map_size = (buffer_size + page_size - 1) & ~(page_size - 1);
+    addr = mmap(NULL, mem->map_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (addr == MAP_FAILED)
+        return RING_BUFFER_ERROR;
+    if (page_type == RING_BUFFER_PAGE_THP)
+        madvise(addr, mem->map_size, MADV_HUGEPAGE); //Only a hint, ignore the result when THP is disabled
+    mem->map_addr = addr;
+    mem->page_type = page_type;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Bind a range of the storage to the NUMA node and prefault it, as set in the mapping record (private function)
+ * \param[in] mem: Mapping record
+ * \param[in] offset: Start of the range, page aligned
+ * \param[in] size: Size of the range, page aligned
+ * \return Return the result
+ *      \arg RING_BUFFER_SUCCESS: Range placed
+ *      \arg RING_BUFFER_ERROR: Node out of range or the kernel refused the binding
+*/
+static uint8_t Ring_Buffer_Alloc_Place(ring_buffer_mem *mem, size_t offset, size_t size)
+{
+    uint8_t *addr = (uint8_t *)mem->map_addr + offset;
+    //Bind before the first touch, pages are placed when they are faulted in
+    if (mem->numa_node >= 0)
+    {
+        unsigned long node_mask[4] = {0};
+        const size_t word_bits = sizeof(unsigned long) * 8;
+        long result = -1;
+        if ((size_t)mem->numa_node < sizeof(node_mask) * 8)
+        {
+            node_mask[mem->numa_node / word_bits] |= 1UL << (mem->numa_node % word_bits);
+            result = syscall(SYS_mbind, addr, size, RING_BUFFER_MPOL_BIND, node_mask, sizeof(node_mask) * 8, 0);
+        }
+        if (result != 0)
+            return RING_BUFFER_ERROR;
+    }
+    if (mem->prefault)
+    {
+        size_t step = (size_t)sysconf(_SC_PAGESIZE), i;
+        for (i = 0; i < size; i += step)
+            ((volatile uint8_t *)addr)[i] = 0; //Write fault, allocate the page now
+    }
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Allocate buffer storage only, for buffers initialized by the caller (e.g. Ring_Buffer_Large_Init beyond 4 GB)
+ * \param[out] mem: Mapping record, the storage is at mem->map_addr, keep it for Ring_Buffer_Alloc_Release
+ * \param[in] buffer_size: Storage size in bytes
+ * \param[in] config: Allocation settings
+ * \return Returns the result of the allocation
+ *      \arg RING_BUFFER_SUCCESS: Allocation successful
+ *      \arg RING_BUFFER_ERROR: Allocation failed, nothing is allocated
+*/
+uint8_t Ring_Buffer_Alloc_Storage(ring_buffer_mem *mem, size_t buffer_size, const ring_buffer_alloc_config *config)
+{
+    uint8_t page_type = config->page_type;
+    mem->map_addr = NULL;
+    mem->map_size = 0;
+    if (buffer_size < 2)
+        return RING_BUFFER_ERROR;
+    //The hugetlb pool may be empty, step down to transparent huge pages then normal pages if allowed
+    while (Ring_Buffer_Alloc_Map(mem, buffer_size, page_type) == RING_BUFFER_ERROR)
+    {
+        if (!config->fallback || page_type == RING_BUFFER_PAGE_NORMAL)
+            return RING_BUFFER_ERROR;
+        page_type = (page_type == RING_BUFFER_PAGE_THP) ? RING_BUFFER_PAGE_NORMAL : RING_BUFFER_PAGE_THP;
+    }
+    mem->numa_node = config->numa_node;
+    mem->prefault = config->prefault;
+    if (Ring_Buffer_Alloc_Place(mem, 0, mem->map_size) == RING_BUFFER_ERROR)
+    {
+        Ring_Buffer_Alloc_Release(mem);
+        return RING_BUFFER_ERROR;
+    }
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Allocate storage and initialization new buffer
+ * \param[out] ring_buffer_handle: Buffer structure handle to be initialized
+ * \param[out] mem: Mapping record, keep it for Ring_Buffer_Alloc_Free
+ * \param[in] buffer_size: Buffer size in bytes
+ * \param[in] config: Allocation settings
+ * \return Returns the result of the buffer initialization
+ *      \arg RING_BUFFER_SUCCESS: Initialization successful
+ *      \arg RING_BUFFER_ERROR: initialization failed, nothing is allocated
+*/
+uint8_t Ring_Buffer_Alloc_Init(ring_buffer *ring_buffer_handle, ring_buffer_mem *mem, uint32_t buffer_size, const ring_buffer_alloc_config *config)
+{
+    if (Ring_Buffer_Alloc_Storage(mem, buffer_size, config) == RING_BUFFER_ERROR)
+        return RING_BUFFER_ERROR;
+    return Ring_Buffer_Init(ring_buffer_handle, (uint8_t *)mem->map_addr, buffer_size);
+}
+
+/**
+ * \brief Resize an allocated buffer with mremap, stored data is kept
+ * \details Growing remaps first (the kernel moves pages, not bytes) then fixes a wrapped buffer with Ring_Buffer_Grow_In_Place;
+ * shrinking compacts the data with Ring_Buffer_Shrink_In_Place then remaps; the buffer may move to a new address
+ * \param[out] ring_buffer_handle: Buffer structure initialized by Ring_Buffer_Alloc_Init
+ * \param[out] mem: Mapping record, updated with the new mapping
+ * \param[in] buffer_size: New buffer size in bytes
+ * \return Returns the result of the resize
+ *      \arg RING_BUFFER_SUCCESS: Resize success
+ *      \arg RING_BUFFER_ERROR: Resize failure, the buffer is unchanged
+*/
+uint8_t Ring_Buffer_Alloc_Resize(ring_buffer *ring_buffer_handle, ring_buffer_mem *mem, uint32_t buffer_size)
+{
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    size_t map_size;
+    void *addr;
+    if (mem->page_type == RING_BUFFER_PAGE_HUGE_2M || mem->page_type == RING_BUFFER_PAGE_THP)
+        page_size = (size_t)1 << 21;
+    else if (mem->page_type == RING_BUFFER_PAGE_HUGE_1G)
+        page_size = (size_t)1 << 30;
+    map_size = ((size_t)buffer_size + page_size - 1) & ~(page_size - 1);
+    if (buffer_size >= ring_buffer_handle->max_length)
+    {
+        if (map_size > mem->map_size) //A refused shrink may have left a mapping that already holds the new size
+        {
+            size_t old_size = mem->map_size;
+            addr = mremap(mem->map_addr, mem->map_size, map_size, MREMAP_MAYMOVE);
+            if (addr == MAP_FAILED)
+                return RING_BUFFER_ERROR;
+            mem->map_addr = addr;
+            mem->map_size = map_size;
+            ring_buffer_handle->array_addr = (uint8_t *)addr;
+            //The added pages get the same node binding and prefault as the initial storage
+            if (Ring_Buffer_Alloc_Place(mem, old_size, map_size - old_size) == RING_BUFFER_ERROR)
+            {
+                if (mremap(addr, map_size, old_size, 0) != MAP_FAILED) //Shrinking in place keeps the address
+                    mem->map_size = old_size;
+                return RING_BUFFER_ERROR;
+            }
+        }
+        return Ring_Buffer_Grow_In_Place(ring_buffer_handle, buffer_size);
+    }
+    if (Ring_Buffer_Shrink_In_Place(ring_buffer_handle, buffer_size) == RING_BUFFER_ERROR)
+        return RING_BUFFER_ERROR;
+    if (map_size != mem->map_size)
+    {
+        addr = mremap(mem->map_addr, mem->map_size, map_size, 0);
+        if (addr != MAP_FAILED) //If the kernel refuses, the buffer just keeps the larger mapping
+            mem->map_size = map_size;
+    }
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Release the storage of an allocated buffer
+ * \param[out] ring_buffer_handle: Buffer structure, it can not be used after release
+ * \param[in] mem: Mapping record filled by Ring_Buffer_Alloc_Init
+*/
+void Ring_Buffer_Alloc_Free(ring_buffer *ring_buffer_handle, ring_buffer_mem *mem)
+{
+    Ring_Buffer_Alloc_Release(mem);
+    ring_buffer_handle->array_addr = NULL;
+    ring_buffer_handle->max_length = 0;
+    ring_buffer_handle->head = 0;
+    ring_buffer_handle->tail = 0;
+#ifndef RING_BUFFER_EMPTY_SLOT
+    ring_buffer_handle->lenght = 0;
+#endif
+}
+
+/**
+ * \brief Release storage allocated by Ring_Buffer_Alloc_Storage
+ * \param[in,out] mem: Mapping record, cleared after release
+*/
+void Ring_Buffer_Alloc_Release(ring_buffer_mem *mem)
+{
+    if (mem->map_addr != NULL)
+        munmap(mem->map_addr, mem->map_size);
+    mem->map_addr = NULL;
+    mem->map_size = 0;
+}
+
+#endif
@@ -0,0 +1,49 @@
+/**
+ * \file ring_buffer_alloc.h
+ * \brief Ring buffer storage allocation helper correlation definition and statement (Linux)
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.2.2
+*/
+
+#ifndef _RING_BUFFER_ALLOC_H_
+#define _RING_BUFFER_ALLOC_H_
+
+#include <stddef.h>
+#include "ring_buffer.h"
+
+// Page type of the buffer storage
+#define RING_BUFFER_PAGE_NORMAL     0x00 //Normal pages
+#define RING_BUFFER_PAGE_THP        0x01 //Normal mapping, ask the kernel for transparent huge pages (madvise)
+#define RING_BUFFER_PAGE_HUGE_2M    0x02 //2 MB hugetlb pages (MAP_HUGETLB)
+#define RING_BUFFER_PAGE_HUGE_1G    0x03 //1 GB hugetlb pages (MAP_HUGETLB)
+
+// Any NUMA node, no binding
+#define RING_BUFFER_NUMA_ANY        (-1)
+
+// Allocation settings
+typedef struct
+{
+    uint8_t page_type; //RING_BUFFER_PAGE_xxx
+    uint8_t fallback;  //Fall back to THP / normal pages if the hugetlb pool is empty, 0: fail instead
+    uint8_t prefault;  //Touch every page at init so no page fault happens during capture
+    int numa_node;     //NUMA node to bind the storage to, RING_BUFFER_NUMA_ANY: no binding
+} ring_buffer_alloc_config;
+
+// Mapping record, needed to release the storage
+typedef struct
+{
+    void *map_addr;    //Mapping base address
+    size_t map_size;   //Mapping size, rounded up to the page size actually used
+    uint8_t page_type; //Page type actually used after fallback
+    uint8_t prefault;  //Prefault pages added by Ring_Buffer_Alloc_Resize
+    int numa_node;     //NUMA node pages added by Ring_Buffer_Alloc_Resize are bound to
+} ring_buffer_mem;
+
+uint8_t Ring_Buffer_Alloc_Storage(ring_buffer_mem *mem, size_t buffer_size, const ring_buffer_alloc_config *config);                                 //Allocate storage only, the caller initializes the buffer
+uint8_t Ring_Buffer_Alloc_Init(ring_buffer *ring_buffer_handle, ring_buffer_mem *mem, uint32_t buffer_size, const ring_buffer_alloc_config *config); //Allocate storage and initialization new buffer
+uint8_t Ring_Buffer_Alloc_Resize(ring_buffer *ring_buffer_handle, ring_buffer_mem *mem, uint32_t buffer_size);                                       //Resize an allocated buffer with mremap, keep the data
+void Ring_Buffer_Alloc_Free(ring_buffer *ring_buffer_handle, ring_buffer_mem *mem);                                                                  //Release the storage of an allocated buffer
+void Ring_Buffer_Alloc_Release(ring_buffer_mem *mem);                                                                                                //Release storage allocated by Ring_Buffer_Alloc_Storage
+
+#endif
@@ -0,0 +1,239 @@
+/**
+ * \file ring_buffer_broadcast.c
+ * \brief Broadcast ring buffer (one writer, several independent readers) implementation
+ * \details One write serves every reader: there is a single tail pointer and one head pointer per reader (logger, parser, forwarder ...);
+ * Each reader reads and deletes its own data, the data itself is stored once;
+ * In BLOCK mode the writable space is limited by the slowest reader, in OVERWRITE mode the writer never waits,
+ * a reader that falls a whole buffer behind is moved to the oldest remaining data and its lapped flag is set;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+*/
+
+#include "ring_buffer_broadcast.h"
+
+/**
+ * \brief Initialization new buffer
+ * \param[out] ring_buffer_handle: Buffer structure handle to be initialized
+ * \param[in] buffer_addr: Array of external definitions, type must be uint8_t
+ * \param[in] buffer_size: External defined buffer array space
+ * \param[in] policy: RING_BUFFER_BROADCAST_BLOCK / RING_BUFFER_BROADCAST_OVERWRITE
+ * \return Returns the result of the buffer initialization
+ *      \arg RING_BUFFER_SUCCESS: Initialization successful
+ *      \arg RING_BUFFER_ERROR: initialization failed
+*/
+uint8_t Ring_Buffer_Broadcast_Init(ring_buffer_broadcast *ring_buffer_handle, uint8_t *buffer_addr, uint32_t buffer_size, uint8_t policy)
+{
+    uint8_t i;
+    ring_buffer_handle->tail = 0;
+    ring_buffer_handle->array_addr = buffer_addr;
+    ring_buffer_handle->max_length = buffer_size;
+    ring_buffer_handle->policy = policy;
+    for (i = 0; i < RING_BUFFER_BROADCAST_MAX_READERS; i++)
+        ring_buffer_handle->readers[i].active = 0;
+    if (buffer_size < 2 || policy > RING_BUFFER_BROADCAST_OVERWRITE)
+        return RING_BUFFER_ERROR;
+    else
+        return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Add a reader, it starts at the current tail and sees data written from now on
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] reader_id: Id of the new reader
+ * \return Return the result
+ *      \arg RING_BUFFER_SUCCESS: Reader added
+ *      \arg RING_BUFFER_ERROR: All reader slots are in use
+*/
+uint8_t Ring_Buffer_Broadcast_Add_Reader(ring_buffer_broadcast *ring_buffer_handle, uint8_t *reader_id)
+{
+    uint8_t i;
+    for (i = 0; i < RING_BUFFER_BROADCAST_MAX_READERS; i++)
+    {
+        if (!ring_buffer_handle->readers[i].active)
+        {
+            ring_buffer_handle->readers[i].head = ring_buffer_handle->tail;
+            ring_buffer_handle->readers[i].lenght = 0;
+            ring_buffer_handle->readers[i].lapped = 0;
+            ring_buffer_handle->readers[i].active = 1;
+            *reader_id = i;
+            return RING_BUFFER_SUCCESS;
+        }
+    }
+    return RING_BUFFER_ERROR;
+}
+
+/**
+ * \brief Remove a reader, its unread data no longer limits the writer
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] reader_id: Id of the reader
+ * \return Return the result
+ *      \arg RING_BUFFER_SUCCESS: Reader removed
+ *      \arg RING_BUFFER_ERROR: No such reader
+*/
+uint8_t Ring_Buffer_Broadcast_Remove_Reader(ring_buffer_broadcast *ring_buffer_handle, uint8_t reader_id)
+{
+    if (reader_id >= RING_BUFFER_BROADCAST_MAX_READERS || !ring_buffer_handle->readers[reader_id].active)
+        return RING_BUFFER_ERROR;
+    ring_buffer_handle->readers[reader_id].active = 0;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Get the space that can be written without lapping a reader, limited by the slowest reader
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \return Return to buffer available storage space
+*/
+uint32_t Ring_Buffer_Broadcast_Get_FreeSize(ring_buffer_broadcast *ring_buffer_handle)
+{
+    uint32_t max_lenght = 0;
+    uint8_t i;
+    for (i = 0; i < RING_BUFFER_BROADCAST_MAX_READERS; i++)
+        if (ring_buffer_handle->readers[i].active && ring_buffer_handle->readers[i].lenght > max_lenght)
+            max_lenght = ring_buffer_handle->readers[i].lenght;
+    return ring_buffer_handle->max_length - max_lenght;
+}
+
+/**
+ * \brief Write the data of the specified length to the tail of the buffer, every reader will read it
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] input_addr: Base site to be written to
+ * \param[in] write_lenght: Number of bytes to be written
+ * \return Returns the result of the write
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure (BLOCK: the slowest reader has not freed enough space; OVERWRITE: longer than the buffer)
+*/
+uint8_t Ring_Buffer_Broadcast_Write_String(ring_buffer_broadcast *ring_buffer_handle, const void *input_addr, uint32_t write_lenght)
+{
+    uint32_t write_size_a;
+    uint8_t i;
+    if (write_lenght > ring_buffer_handle->max_length)
+        return RING_BUFFER_ERROR;
+    if (ring_buffer_handle->policy == RING_BUFFER_BROADCAST_BLOCK &&
+        write_lenght > Ring_Buffer_Broadcast_Get_FreeSize(ring_buffer_handle))
+        return RING_BUFFER_ERROR;
+    //Write once, split at the end of the array
+    write_size_a = ring_buffer_handle->max_length - ring_buffer_handle->tail;
+    if (write_size_a >= write_lenght)
+    {
+        memcpy(ring_buffer_handle->array_addr + ring_buffer_handle->tail, input_addr, write_lenght);
+        ring_buffer_handle->tail += write_lenght;
+        if (ring_buffer_handle->tail == ring_buffer_handle->max_length)
+            ring_buffer_handle->tail = 0;
+    }
+    else //Need to write twice
+    {
+        memcpy(ring_buffer_handle->array_addr + ring_buffer_handle->tail, input_addr, write_size_a);
+        memcpy(ring_buffer_handle->array_addr, (const uint8_t *)input_addr + write_size_a, write_lenght - write_size_a);
+        ring_buffer_handle->tail = write_lenght - write_size_a;
+    }
+    //Every reader gets the new data, a reader that is overtaken keeps the newest max_length bytes
+    for (i = 0; i < RING_BUFFER_BROADCAST_MAX_READERS; i++)
+    {
+        ring_buffer_reader *reader = &ring_buffer_handle->readers[i];
+        if (!reader->active)
+            continue;
+        if (reader->lenght + write_lenght > ring_buffer_handle->max_length)
+        {
+            reader->head = ring_buffer_handle->tail; //Oldest data still in the buffer starts at the new tail
+            reader->lenght = ring_buffer_handle->max_length;
+            reader->lapped = 1;
+        }
+        else
+            reader->lenght += write_lenght;
+    }
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Read the data of the specified length for one reader, other readers are not affected
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] reader_id: Id of the reader
+ * \param[out] output_addr: Read data saved address
+ * \param[in] read_lenght: Number of bytes to read
+ * \return Returns the result of the read
+ *      \arg RING_BUFFER_SUCCESS: Read success
+ *      \arg RING_BUFFER_ERROR: Read failure
+*/
+uint8_t Ring_Buffer_Broadcast_Read_String(ring_buffer_broadcast *ring_buffer_handle, uint8_t reader_id, uint8_t *output_addr, uint32_t read_lenght)
+{
+    ring_buffer_reader *reader;
+    uint32_t read_size_a;
+    if (reader_id >= RING_BUFFER_BROADCAST_MAX_READERS || !ring_buffer_handle->readers[reader_id].active)
+        return RING_BUFFER_ERROR;
+    reader = &ring_buffer_handle->readers[reader_id];
+    if (read_lenght > reader->lenght)
+        return RING_BUFFER_ERROR;
+    read_size_a = ring_buffer_handle->max_length - reader->head;
+    if (read_size_a >= read_lenght)
+    {
+        memcpy(output_addr, ring_buffer_handle->array_addr + reader->head, read_lenght);
+        reader->head += read_lenght;
+        if (reader->head == ring_buffer_handle->max_length)
+            reader->head = 0;
+    }
+    else //Need to read twice
+    {
+        memcpy(output_addr, ring_buffer_handle->array_addr + reader->head, read_size_a);
+        memcpy(output_addr + read_size_a, ring_buffer_handle->array_addr, read_lenght - read_size_a);
+        reader->head = read_lenght - read_size_a;
+    }
+    reader->lenght -= read_lenght;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Delete data of one reader from its head pointer
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] reader_id: Id of the reader
+ * \param[in] lenght: To delete the length
+ * \return Return to delete the specified length data result
+ *      \arg RING_BUFFER_SUCCESS: successfully deleted
+ *      \arg RING_BUFFER_ERROR: failed to delete
+*/
+uint8_t Ring_Buffer_Broadcast_Delete(ring_buffer_broadcast *ring_buffer_handle, uint8_t reader_id, uint32_t lenght)
+{
+    ring_buffer_reader *reader;
+    if (reader_id >= RING_BUFFER_BROADCAST_MAX_READERS || !ring_buffer_handle->readers[reader_id].active)
+        return RING_BUFFER_ERROR;
+    reader = &ring_buffer_handle->readers[reader_id];
+    if (reader->lenght < lenght)
+        return RING_BUFFER_ERROR;
+    if (lenght >= ring_buffer_handle->max_length - reader->head)
+        reader->head = lenght - (ring_buffer_handle->max_length - reader->head);
+    else
+        reader->head += lenght;
+    reader->lenght -= lenght;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Check and clear the lapped flag of one reader
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] reader_id: Id of the reader
+ * \return Returns 1 if the reader lost data since the last check, otherwise 0
+*/
+uint8_t Ring_Buffer_Broadcast_Check_Lapped(ring_buffer_broadcast *ring_buffer_handle, uint8_t reader_id)
+{
+    uint8_t lapped;
+    if (reader_id >= RING_BUFFER_BROADCAST_MAX_READERS)
+        return 0;
+    lapped = ring_buffer_handle->readers[reader_id].lapped;
+    ring_buffer_handle->readers[reader_id].lapped = 0;
+    return lapped;
+}
+
+/**
+ * \brief Get the data length one reader has not read yet
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] reader_id: Id of the reader
+ * \return Returns the amount of data stored for this reader
+*/
+uint32_t Ring_Buffer_Broadcast_Get_Length(ring_buffer_broadcast *ring_buffer_handle, uint8_t reader_id)
+{
+    if (reader_id >= RING_BUFFER_BROADCAST_MAX_READERS || !ring_buffer_handle->readers[reader_id].active)
+        return 0;
+    return ring_buffer_handle->readers[reader_id].lenght;
+}
@@ -0,0 +1,52 @@
+/**
+ * \file ring_buffer_broadcast.h
+ * \brief Broadcast ring buffer (one writer, several independent readers) correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_BROADCAST_H_
+#define _RING_BUFFER_BROADCAST_H_
+
+#include "ring_buffer.h"
+
+// Maximum number of readers of one broadcast buffer
+#ifndef RING_BUFFER_BROADCAST_MAX_READERS
+#define RING_BUFFER_BROADCAST_MAX_READERS   8
+#endif
+
+// Policy when the slowest reader has not freed enough space
+#define RING_BUFFER_BROADCAST_BLOCK         0x00 //Write fails, space is limited by the slowest reader
+#define RING_BUFFER_BROADCAST_OVERWRITE     0x01 //Write succeeds, slow readers are lapped and lose their oldest data
+
+// Reader cursor
+typedef struct
+{
+    uint32_t head;   //Operating head pointer of this reader
+    uint32_t lenght; //Data volume not read yet by this reader
+    uint8_t active;  //Reader slot is in use
+    uint8_t lapped;  //Reader lost data because it was overwritten
+} ring_buffer_reader;
+
+// Broadcast ring buffer structure
+typedef struct
+{
+    uint32_t tail;                                                //Operate tail pointer
+    uint8_t *array_addr;                                          //Buffer storage number base address
+    uint32_t max_length;                                          //Buffer maximum storage data amount
+    uint8_t policy;                                               //RING_BUFFER_BROADCAST_BLOCK / RING_BUFFER_BROADCAST_OVERWRITE
+    ring_buffer_reader readers[RING_BUFFER_BROADCAST_MAX_READERS]; //Reader cursors
+} ring_buffer_broadcast;
+
+uint8_t Ring_Buffer_Broadcast_Init(ring_buffer_broadcast *ring_buffer_handle, uint8_t *buffer_addr, uint32_t buffer_size, uint8_t policy);              //Initialization new buffer
+uint8_t Ring_Buffer_Broadcast_Add_Reader(ring_buffer_broadcast *ring_buffer_handle, uint8_t *reader_id);                                                //Add a reader, it sees data written from now on
+uint8_t Ring_Buffer_Broadcast_Remove_Reader(ring_buffer_broadcast *ring_buffer_handle, uint8_t reader_id);                                              //Remove a reader
+uint8_t Ring_Buffer_Broadcast_Write_String(ring_buffer_broadcast *ring_buffer_handle, const void *input_addr, uint32_t write_lenght);                   //Write the specified length data for all readers
+uint8_t Ring_Buffer_Broadcast_Read_String(ring_buffer_broadcast *ring_buffer_handle, uint8_t reader_id, uint8_t *output_addr, uint32_t read_lenght);    //Read the specified length data for one reader
+uint8_t Ring_Buffer_Broadcast_Delete(ring_buffer_broadcast *ring_buffer_handle, uint8_t reader_id, uint32_t lenght);                                    //Delete data of one reader from its head pointer
+uint8_t Ring_Buffer_Broadcast_Check_Lapped(ring_buffer_broadcast *ring_buffer_handle, uint8_t reader_id);                                               //Check and clear the lapped flag of one reader
+uint32_t Ring_Buffer_Broadcast_Get_Length(ring_buffer_broadcast *ring_buffer_handle, uint8_t reader_id);                                                //Get the data length one reader has not read yet
+uint32_t Ring_Buffer_Broadcast_Get_FreeSize(ring_buffer_broadcast *ring_buffer_handle);                                                                 //Get the space that can be written without lapping a reader
+
+#endif
@@ -0,0 +1,329 @@
+/**
+ * \file ring_buffer_chain.c
+ * \brief Segmented ring buffer that grows by linking pool segments implementation
+ * \details Instead of one array sized for the worst burst, the buffer is a chain of fixed-size segments;
+ * When the tail segment is full a free segment is taken from the pool and linked, when the head segment is drained it goes back to the pool,
+ * so memory follows the data actually stored; push / pop are O(1) and copies are contiguous inside a segment;
+ * One pool can serve thousands of buffers (one per device): total memory follows the total backlog instead of device count x peak,
+ * a per-buffer segment limit keeps one device from taking the whole pool, and the pool records used / peak / refused counts;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.1.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+ * 2026.10.16 v1.1.0 Pool shared by many buffers: per-buffer segment limit, pool accounting, add memory at run time
+*/
+
+#include "ring_buffer_chain.h"
+
+/**
+ * \brief Add another external array of segments to a pool, the pool grows without touching the buffers using it
+ * \param[in] pool: Pool structure
+ * \param[in] pool_addr: Array of external definitions, aligned for a pointer
+ * \param[in] pool_size: Array size in bytes
+ * \return Return the result
+ *      \arg RING_BUFFER_SUCCESS: Segments added
+ *      \arg RING_BUFFER_ERROR: The array can not hold one segment
+*/
+uint8_t Ring_Buffer_Pool_Add_Memory(ring_buffer_pool *pool, void *pool_addr, uint32_t pool_size)
+{
+    //Segment header + data, rounded up so the next header stays aligned
+    size_t stride = (sizeof(ring_buffer_segment) + pool->segment_size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+    uint32_t count = (pool->segment_size == 0) ? 0 : (uint32_t)(pool_size / stride);
+    ring_buffer_segment *first = NULL;
+    ring_buffer_segment *last = NULL;
+    uint32_t i;
+    if (count == 0)
+        return RING_BUFFER_ERROR;
+    for (i = count; i > 0; i--) //Link from the end so the list starts at the array base
+    {
+        ring_buffer_segment *segment = (ring_buffer_segment *)((uint8_t *)pool_addr + (size_t)(i - 1) * stride);
+        segment->next = first;
+        first = segment;
+        if (last == NULL)
+            last = segment;
+    }
+    RING_BUFFER_POOL_LOCK(pool);
+    last->next = pool->free_list;
+    pool->free_list = first;
+    pool->segment_count += count;
+    pool->free_count += count;
+    RING_BUFFER_POOL_UNLOCK(pool);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Initialization new segment pool on an external array
+ * \param[out] pool: Pool structure to be initialized
+ * \param[in] pool_addr: Array of external definitions, aligned for a pointer
+ * \param[in] pool_size: Array size in bytes
+ * \param[in] segment_size: Data bytes of one segment
+ * \return Returns the result of the pool initialization
+ *      \arg RING_BUFFER_SUCCESS: Initialization successful
+ *      \arg RING_BUFFER_ERROR: initialization failed, the array can not hold one segment
+*/
+uint8_t Ring_Buffer_Pool_Init(ring_buffer_pool *pool, void *pool_addr, uint32_t pool_size, uint32_t segment_size)
+{
+    pool->free_list = NULL;
+    pool->segment_size = segment_size;
+    pool->segment_count = 0;
+    pool->free_count = 0;
+    pool->peak_used = 0;
+    pool->fail_count = 0;
+    return Ring_Buffer_Pool_Add_Memory(pool, pool_addr, pool_size);
+}
+
+/**
+ * \brief Get the pool accounting, segments used by all buffers together
+ * \param[in] pool: Pool structure
+ * \param[out] stats: Accounting snapshot
+*/
+void Ring_Buffer_Pool_Get_Stats(ring_buffer_pool *pool, ring_buffer_pool_stats *stats)
+{
+    RING_BUFFER_POOL_LOCK(pool);
+    stats->segment_size = pool->segment_size;
+    stats->segment_count = pool->segment_count;
+    stats->used_count = pool->segment_count - pool->free_count;
+    stats->peak_used = pool->peak_used;
+    stats->fail_count = pool->fail_count;
+    RING_BUFFER_POOL_UNLOCK(pool);
+}
+
+/**
+ * \brief Take several free segments from the pool at once, linked together (private function)
+ * \param[in] pool: Pool structure
+ * \param[in] number: Number of segments, not 0
+ * \return Return the first segment of the list, NULL if the pool has not enough free segments
+*/
+static ring_buffer_segment *Ring_Buffer_Pool_Get(ring_buffer_pool *pool, uint32_t number)
+{
+    ring_buffer_segment *first, *last;
+    uint32_t i;
+    RING_BUFFER_POOL_LOCK(pool);
+    if (pool->free_count < number)
+    {
+        pool->fail_count++;
+        RING_BUFFER_POOL_UNLOCK(pool);
+        return NULL;
+    }
+    first = pool->free_list;
+    last = first;
+    for (i = 1; i < number; i++)
+        last = last->next;
+    pool->free_list = last->next;
+    pool->free_count -= number;
+    if (pool->segment_count - pool->free_count > pool->peak_used)
+        pool->peak_used = pool->segment_count - pool->free_count;
+    RING_BUFFER_POOL_UNLOCK(pool);
+    last->next = NULL;
+    return first;
+}
+
+/**
+ * \brief Give a segment back to the pool (private function)
+ * \param[in] pool: Pool structure
+ * \param[in] segment: Segment no longer used
+*/
+static void Ring_Buffer_Pool_Put(ring_buffer_pool *pool, ring_buffer_segment *segment)
+{
+    RING_BUFFER_POOL_LOCK(pool);
+    segment->next = pool->free_list;
+    pool->free_list = segment;
+    pool->free_count++;
+    RING_BUFFER_POOL_UNLOCK(pool);
+}
+
+/**
+ * \brief Initialization new chained buffer, it holds no segment until data is written
+ * \param[out] ring_buffer_handle: Buffer structure handle to be initialized
+ * \param[in] pool: Pool the segments are taken from, can be shared by many buffers
+ * \return Returns the result of the buffer initialization
+ *      \arg RING_BUFFER_SUCCESS: Initialization successful
+*/
+uint8_t Ring_Buffer_Chain_Init(ring_buffer_chain *ring_buffer_handle, ring_buffer_pool *pool)
+{
+    ring_buffer_handle->head_seg = NULL;
+    ring_buffer_handle->tail_seg = NULL;
+    ring_buffer_handle->head = 0;
+    ring_buffer_handle->tail = 0;
+    ring_buffer_handle->lenght = 0;
+    ring_buffer_handle->pool = pool;
+    ring_buffer_handle->segment_used = 0;
+    ring_buffer_handle->segment_limit = 0;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Set the maximum segments one buffer may hold, so one busy device can not drain the shared pool
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] segment_limit: Maximum number of segments, 0: no limit
+*/
+void Ring_Buffer_Chain_Set_Limit(ring_buffer_chain *ring_buffer_handle, uint32_t segment_limit)
+{
+    ring_buffer_handle->segment_limit = segment_limit;
+}
+
+/**
+ * \brief Get the space that can still be written, limited by the free segments and this buffer's limit
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \return Return to buffer available storage space
+*/
+uint32_t Ring_Buffer_Chain_Get_FreeSize(ring_buffer_chain *ring_buffer_handle)
+{
+    ring_buffer_pool *pool = ring_buffer_handle->pool;
+    uint32_t tail_free = (ring_buffer_handle->tail_seg == NULL) ? 0 : pool->segment_size - ring_buffer_handle->tail;
+    uint32_t segment_free = pool->free_count;
+    uint64_t free_size;
+    if (ring_buffer_handle->segment_limit != 0)
+    {
+        uint32_t limit_free = (ring_buffer_handle->segment_used >= ring_buffer_handle->segment_limit) ? 0 : ring_buffer_handle->segment_limit - ring_buffer_handle->segment_used;
+        if (limit_free < segment_free)
+            segment_free = limit_free;
+    }
+    free_size = (uint64_t)segment_free * pool->segment_size + tail_free;
+    return (free_size > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)free_size;
+}
+
+/**
+ * \brief Write the data of the specified length to the tail of the buffer, linking new segments when needed
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] input_addr: Base site to be written to
+ * \param[in] write_lenght: Number of bytes to be written
+ * \return Returns the result of the write
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure, not enough free segments or over the buffer's limit, nothing is written
+*/
+uint8_t Ring_Buffer_Chain_Write_String(ring_buffer_chain *ring_buffer_handle, const void *input_addr, uint32_t write_lenght)
+{
+    ring_buffer_pool *pool = ring_buffer_handle->pool;
+    const uint8_t *input = (const uint8_t *)input_addr;
+    uint32_t tail_free = (ring_buffer_handle->tail_seg == NULL) ? 0 : pool->segment_size - ring_buffer_handle->tail;
+    ring_buffer_segment *new_segs = NULL;
+    if (write_lenght > tail_free) //Take all needed segments at once, so a shared pool can not run out halfway
+    {
+        uint32_t need = (uint32_t)(((uint64_t)(write_lenght - tail_free) + pool->segment_size - 1) / pool->segment_size);
+        if (ring_buffer_handle->segment_limit != 0 && ring_buffer_handle->segment_used + need > ring_buffer_handle->segment_limit)
+            return RING_BUFFER_ERROR;
+        new_segs = Ring_Buffer_Pool_Get(pool, need);
+        if (new_segs == NULL)
+            return RING_BUFFER_ERROR;
+        ring_buffer_handle->segment_used += need;
+    }
+    while (write_lenght != 0)
+    {
+        uint32_t write_size;
+        if (ring_buffer_handle->tail_seg == NULL) //Empty buffer, the first segment
+        {
+            ring_buffer_handle->tail_seg = new_segs;
+            ring_buffer_handle->head_seg = new_segs;
+            new_segs = new_segs->next;
+            ring_buffer_handle->tail_seg->next = NULL;
+            ring_buffer_handle->head = 0;
+            ring_buffer_handle->tail = 0;
+        }
+        else if (ring_buffer_handle->tail == pool->segment_size) //Tail segment is full, link a new one
+        {
+            ring_buffer_handle->tail_seg->next = new_segs;
+            ring_buffer_handle->tail_seg = new_segs;
+            new_segs = new_segs->next;
+            ring_buffer_handle->tail_seg->next = NULL;
+            ring_buffer_handle->tail = 0;
+        }
+        write_size = pool->segment_size - ring_buffer_handle->tail;
+        if (write_size > write_lenght)
+            write_size = write_lenght;
+        memcpy(ring_buffer_handle->tail_seg->data + ring_buffer_handle->tail, input, write_size);
+        ring_buffer_handle->tail += write_size;
+        ring_buffer_handle->lenght += write_size;
+        input += write_size;
+        write_lenght -= write_size;
+    }
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Take data from the head, copy it if output_addr is given, and return drained segments to the pool (private function)
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] output_addr: Read data saved address, NULL to discard
+ * \param[in] read_lenght: Number of bytes, no more than the stored data
+*/
+static void Ring_Buffer_Chain_Consume(ring_buffer_chain *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght)
+{
+    ring_buffer_pool *pool = ring_buffer_handle->pool;
+    while (read_lenght != 0)
+    {
+        //Data of the head segment ends at the tail pointer if it is also the tail segment
+        uint32_t segment_end = (ring_buffer_handle->head_seg == ring_buffer_handle->tail_seg) ? ring_buffer_handle->tail : pool->segment_size;
+        uint32_t read_size = segment_end - ring_buffer_handle->head;
+        if (read_size > read_lenght)
+            read_size = read_lenght;
+        if (output_addr != NULL)
+        {
+            memcpy(output_addr, ring_buffer_handle->head_seg->data + ring_buffer_handle->head, read_size);
+            output_addr += read_size;
+        }
+        ring_buffer_handle->head += read_size;
+        ring_buffer_handle->lenght -= read_size;
+        read_lenght -= read_size;
+        if (ring_buffer_handle->head == segment_end && ring_buffer_handle->head_seg != ring_buffer_handle->tail_seg)
+        {
+            ring_buffer_segment *drained = ring_buffer_handle->head_seg; //Head segment drained, return it
+            ring_buffer_handle->head_seg = drained->next;
+            ring_buffer_handle->head = 0;
+            ring_buffer_handle->segment_used--;
+            Ring_Buffer_Pool_Put(pool, drained);
+        }
+    }
+    if (ring_buffer_handle->lenght == 0 && ring_buffer_handle->head_seg != NULL) //Empty, the last segment goes back too
+    {
+        Ring_Buffer_Pool_Put(pool, ring_buffer_handle->head_seg);
+        ring_buffer_handle->segment_used--;
+        ring_buffer_handle->head_seg = NULL;
+        ring_buffer_handle->tail_seg = NULL;
+        ring_buffer_handle->head = 0;
+        ring_buffer_handle->tail = 0;
+    }
+}
+
+/**
+ * \brief Read the data of the specified length from the buffer header
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] output_addr: Read data saved address
+ * \param[in] read_lenght: Number of bytes to read
+ * \return Returns the result of the read
+ *      \arg RING_BUFFER_SUCCESS: Read success
+ *      \arg RING_BUFFER_ERROR: Read failure
+*/
+uint8_t Ring_Buffer_Chain_Read_String(ring_buffer_chain *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght)
+{
+    if (read_lenght > ring_buffer_handle->lenght)
+        return RING_BUFFER_ERROR;
+    Ring_Buffer_Chain_Consume(ring_buffer_handle, output_addr, read_lenght);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Delete data from the head pointer to the specified length
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] lenght: To delete the length
+ * \return Return to delete the specified length data result
+ *      \arg RING_BUFFER_SUCCESS: successfully deleted
+ *      \arg RING_BUFFER_ERROR: failed to delete
+*/
+uint8_t Ring_Buffer_Chain_Delete(ring_buffer_chain *ring_buffer_handle, uint32_t lenght)
+{
+    if (lenght > ring_buffer_handle->lenght)
+        return RING_BUFFER_ERROR;
+    Ring_Buffer_Chain_Consume(ring_buffer_handle, NULL, lenght);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Get the data length that has been stored in the buffer
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \return Returns the amount of data already stored in the buffer
+*/
+uint32_t Ring_Buffer_Chain_Get_Length(ring_buffer_chain *ring_buffer_handle)
+{
+    return ring_buffer_handle->lenght;
+}
@@ -0,0 +1,73 @@
+/**
+ * \file ring_buffer_chain.h
+ * \brief Segmented ring buffer that grows by linking pool segments correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.1.0
+*/
+
+#ifndef _RING_BUFFER_CHAIN_H_
+#define _RING_BUFFER_CHAIN_H_
+
+#include <stddef.h>
+#include "ring_buffer.h"
+
+// Pool lock, a pool shared by buffers in different threads / interrupts must define these (e.g. disable interrupts, take a mutex)
+#ifndef RING_BUFFER_POOL_LOCK
+#define RING_BUFFER_POOL_LOCK(pool)
+#define RING_BUFFER_POOL_UNLOCK(pool)
+#endif
+
+// Segment, fixed data size set by the pool
+typedef struct ring_buffer_segment
+{
+    struct ring_buffer_segment *next; //Next segment in the chain / free list
+    uint8_t data[];                   //Segment data
+} ring_buffer_segment;
+
+// Segment pool, segments are carved from external arrays and shared by many buffers
+typedef struct
+{
+    ring_buffer_segment *free_list; //Free segments
+    uint32_t segment_size;          //Data bytes of one segment
+    uint32_t segment_count;         //Total number of segments
+    uint32_t free_count;            //Number of free segments
+    uint32_t peak_used;             //Highest number of segments in use at the same time
+    uint32_t fail_count;            //Writes refused because the pool was empty
+} ring_buffer_pool;
+
+// Pool accounting snapshot
+typedef struct
+{
+    uint32_t segment_size;  //Data bytes of one segment
+    uint32_t segment_count; //Total number of segments
+    uint32_t used_count;    //Segments in use by all buffers
+    uint32_t peak_used;     //Highest number of segments in use at the same time
+    uint32_t fail_count;    //Writes refused because the pool was empty
+} ring_buffer_pool_stats;
+
+// Chained ring buffer structure
+typedef struct
+{
+    ring_buffer_segment *head_seg; //Segment holding the head pointer, NULL when empty
+    ring_buffer_segment *tail_seg; //Segment holding the tail pointer, NULL when empty
+    uint32_t head;                 //Operating head pointer inside head_seg
+    uint32_t tail;                 //Operate tail pointer inside tail_seg
+    uint32_t lenght;               //Saved data volume
+    ring_buffer_pool *pool;        //Pool the segments are taken from
+    uint32_t segment_used;         //Segments held by this buffer
+    uint32_t segment_limit;        //Maximum segments this buffer may hold, 0: no limit
+} ring_buffer_chain;
+
+uint8_t Ring_Buffer_Pool_Init(ring_buffer_pool *pool, void *pool_addr, uint32_t pool_size, uint32_t segment_size);                  //Initialization new segment pool on an external array
+uint8_t Ring_Buffer_Pool_Add_Memory(ring_buffer_pool *pool, void *pool_addr, uint32_t pool_size);                                 //Add another external array of segments to a pool
+void Ring_Buffer_Pool_Get_Stats(ring_buffer_pool *pool, ring_buffer_pool_stats *stats);                                              //Get the pool accounting
+uint8_t Ring_Buffer_Chain_Init(ring_buffer_chain *ring_buffer_handle, ring_buffer_pool *pool);                                        //Initialization new chained buffer
+void Ring_Buffer_Chain_Set_Limit(ring_buffer_chain *ring_buffer_handle, uint32_t segment_limit);                                      //Set the maximum segments one buffer may hold
+uint8_t Ring_Buffer_Chain_Write_String(ring_buffer_chain *ring_buffer_handle, const void *input_addr, uint32_t write_lenght);         //Write the specified length data to the buffer
+uint8_t Ring_Buffer_Chain_Read_String(ring_buffer_chain *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght);             //Read the specified length data from the buffer
+uint8_t Ring_Buffer_Chain_Delete(ring_buffer_chain *ring_buffer_handle, uint32_t lenght);                                             //Delete data from the head pointer to the specified length
+uint32_t Ring_Buffer_Chain_Get_Length(ring_buffer_chain *ring_buffer_handle);                                                         //Get the data length that has been stored in the buffer
+uint32_t Ring_Buffer_Chain_Get_FreeSize(ring_buffer_chain *ring_buffer_handle);                                                       //Get the space that can still be written with the free segments
+
+#endif
@@ -0,0 +1,419 @@
+/**
+ * \file ring_buffer_copy.c
+ * \brief Ring buffer copy and search kernels implementation
+ * \details With RING_BUFFER_NT_COPY defined, the string read / write functions copy through here instead of memcpy,
+ * and Ring_Buffer_Find_Keyword looks for the trigger byte here instead of memchr;
+ * Copies smaller than the threshold are plain memcpy, the data is likely read back soon from the same cache;
+ * A large write goes through non-temporal stores: the burst is only read by the consumer, usually on another core,
+ * keeping it out of the producer's cache leaves that cache to the producer's own working set;
+ * The stores are fenced (sfence) before returning, so a tail pointer published after the copy never overtakes the data;
+ * A large read prefetches the next block while the current one is copied;
+ * The kernels (SSE2 / AVX2 / AVX-512 on x86, NEON on AArch64) are chosen once at load time from the CPU features,
+ * so one binary runs on every host; the environment variable RING_BUFFER_KERNEL (generic / sse2 / avx2 / avx512 / neon)
+ * forces a variant for benchmarking, a variant the CPU does not support is ignored;
+ * AArch64 has no non-temporal store worth using for this, NEON only speeds up the search, copies stay memcpy;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.1.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+ * 2026.10.16 v1.1.0 Add byte search kernels, kernels are selected once at load time, RING_BUFFER_KERNEL override
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "ring_buffer_copy.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define RING_BUFFER_COPY_X86
+#elif defined(__GNUC__) && defined(__aarch64__)
+#include <arm_neon.h>
+#define RING_BUFFER_COPY_ARM
+#endif
+
+#define RING_BUFFER_COPY_MIN            128  //Below this the alignment head / tail outweigh the streamed part, threshold is never lower
+#define RING_BUFFER_COPY_BLOCK          4096 //Read side block, the next block is prefetched while this one is copied
+#define RING_BUFFER_COPY_LINE           64   //Prefetch step
+
+typedef void (*ring_buffer_copy_kernel)(uint8_t *output_addr, const uint8_t *input_addr, size_t lenght);
+typedef const uint8_t *(*ring_buffer_find_kernel)(const uint8_t *input_addr, uint8_t byte, size_t lenght);
+
+static size_t copy_threshold = RING_BUFFER_COPY_THRESHOLD;
+
+/**
+ * \brief Plain memcpy (private function)
+ * \param[out] output_addr: Destination
+ * \param[in] input_addr: Source
+ * \param[in] lenght: Number of bytes
+*/
+static void Ring_Buffer_Copy_Generic(uint8_t *output_addr, const uint8_t *input_addr, size_t lenght)
+{
+    memcpy(output_addr, input_addr, lenght);
+}
+
+/**
+ * \brief Plain memchr (private function)
+ * \param[in] input_addr: Start of the search
+ * \param[in] byte: Byte to find
+ * \param[in] lenght: Number of bytes to search
+ * \return Returns the address of the first match, NULL: not found
+*/
+static const uint8_t *Ring_Buffer_Find_Generic(const uint8_t *input_addr, uint8_t byte, size_t lenght)
+{
+    return (const uint8_t *)memchr(input_addr, byte, lenght);
+}
+
+#ifdef RING_BUFFER_COPY_X86
+/**
+ * \brief Copy with 16-byte non-temporal stores (private function)
+ * \param[out] output_addr: Destination
+ * \param[in] input_addr: Source
+ * \param[in] lenght: Number of bytes, at least RING_BUFFER_COPY_MIN
+*/
+__attribute__((target("sse2"))) static void Ring_Buffer_Copy_Stream_SSE2(uint8_t *output_addr, const uint8_t *input_addr, size_t lenght)
+{
+    size_t head = (16 - ((uintptr_t)output_addr & 15)) & 15; //Bytes before the first aligned store
+    memcpy(output_addr, input_addr, head);
+    output_addr += head;
+    input_addr += head;
+    lenght -= head;
+    for (; lenght >= 64; lenght -= 64, input_addr += 64, output_addr += 64)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)input_addr);
+        __m128i b = _mm_loadu_si128((const __m128i *)(input_addr + 16));
+        __m128i c = _mm_loadu_si128((const __m128i *)(input_addr + 32));
+        __m128i d = _mm_loadu_si128((const __m128i *)(input_addr + 48));
+        _mm_stream_si128((__m128i *)output_addr, a);
+        _mm_stream_si128((__m128i *)(output_addr + 16), b);
+        _mm_stream_si128((__m128i *)(output_addr + 32), c);
+        _mm_stream_si128((__m128i *)(output_addr + 48), d);
+    }
+    memcpy(output_addr, input_addr, lenght);
+    _mm_sfence(); //Streamed stores are weakly ordered, finish them before the caller publishes the data
+}
+
+/**
+ * \brief Copy with 32-byte non-temporal stores (private function)
+ * \param[out] output_addr: Destination
+ * \param[in] input_addr: Source
+ * \param[in] lenght: Number of bytes, at least RING_BUFFER_COPY_MIN
+*/
+__attribute__((target("avx2"))) static void Ring_Buffer_Copy_Stream_AVX2(uint8_t *output_addr, const uint8_t *input_addr, size_t lenght)
+{
+    size_t head = (32 - ((uintptr_t)output_addr & 31)) & 31; //Bytes before the first aligned store
+    memcpy(output_addr, input_addr, head);
+    output_addr += head;
+    input_addr += head;
+    lenght -= head;
+    for (; lenght >= 128; lenght -= 128, input_addr += 128, output_addr += 128)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i *)input_addr);
+        __m256i b = _mm256_loadu_si256((const __m256i *)(input_addr + 32));
+        __m256i c = _mm256_loadu_si256((const __m256i *)(input_addr + 64));
+        __m256i d = _mm256_loadu_si256((const __m256i *)(input_addr + 96));
+        _mm256_stream_si256((__m256i *)output_addr, a);
+        _mm256_stream_si256((__m256i *)(output_addr + 32), b);
+        _mm256_stream_si256((__m256i *)(output_addr + 64), c);
+        _mm256_stream_si256((__m256i *)(output_addr + 96), d);
+    }
+    memcpy(output_addr, input_addr, lenght);
+    _mm_sfence(); //Streamed stores are weakly ordered, finish them before the caller publishes the data
+}
+
+/**
+ * \brief Copy with 64-byte non-temporal stores (private function)
+ * \param[out] output_addr: Destination
+ * \param[in] input_addr: Source
+ * \param[in] lenght: Number of bytes, at least RING_BUFFER_COPY_MIN
+*/
+__attribute__((target("avx512f"))) static void Ring_Buffer_Copy_Stream_AVX512(uint8_t *output_addr, const uint8_t *input_addr, size_t lenght)
+{
+    size_t head = (64 - ((uintptr_t)output_addr & 63)) & 63; //Bytes before the first aligned store, one cache line per store
+    memcpy(output_addr, input_addr, head);
+    output_addr += head;
+    input_addr += head;
+    lenght -= head;
+    for (; lenght >= 128; lenght -= 128, input_addr += 128, output_addr += 128)
+    {
+        __m512i a = _mm512_loadu_si512((const void *)input_addr);
+        __m512i b = _mm512_loadu_si512((const void *)(input_addr + 64));
+        _mm512_stream_si512((void *)output_addr, a);
+        _mm512_stream_si512((void *)(output_addr + 64), b);
+    }
+    memcpy(output_addr, input_addr, lenght);
+    _mm_sfence(); //Streamed stores are weakly ordered, finish them before the caller publishes the data
+}
+
+/**
+ * \brief Find a byte 16 bytes at a time (private function)
+ * \param[in] input_addr: Start of the search
+ * \param[in] byte: Byte to find
+ * \param[in] lenght: Number of bytes to search
+ * \return Returns the address of the first match, NULL: not found
+*/
+__attribute__((target("sse2"))) static const uint8_t *Ring_Buffer_Find_SSE2(const uint8_t *input_addr, uint8_t byte, size_t lenght)
+{
+    __m128i key = _mm_set1_epi8((char)byte);
+    for (; lenght >= 16; lenght -= 16, input_addr += 16)
+    {
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)input_addr), key));
+        if (mask)
+            return input_addr + __builtin_ctz(mask); //Lowest set bit is the first match
+    }
+    for (; lenght; lenght--, input_addr++) //Tail shorter than one vector
+        if (*input_addr == byte)
+            return input_addr;
+    return NULL;
+}
+
+/**
+ * \brief Find a byte 32 bytes at a time (private function)
+ * \param[in] input_addr: Start of the search
+ * \param[in] byte: Byte to find
+ * \param[in] lenght: Number of bytes to search
+ * \return Returns the address of the first match, NULL: not found
+*/
+__attribute__((target("avx2"))) static const uint8_t *Ring_Buffer_Find_AVX2(const uint8_t *input_addr, uint8_t byte, size_t lenght)
+{
+    __m256i key = _mm256_set1_epi8((char)byte);
+    for (; lenght >= 32; lenght -= 32, input_addr += 32)
+    {
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)input_addr), key));
+        if (mask)
+            return input_addr + __builtin_ctz(mask);
+    }
+    return Ring_Buffer_Find_SSE2(input_addr, byte, lenght); //Tail shorter than one vector
+}
+
+/**
+ * \brief Find a byte 64 bytes at a time (private function)
+ * \param[in] input_addr: Start of the search
+ * \param[in] byte: Byte to find
+ * \param[in] lenght: Number of bytes to search
+ * \return Returns the address of the first match, NULL: not found
+*/
+__attribute__((target("avx512f,avx512bw"))) static const uint8_t *Ring_Buffer_Find_AVX512(const uint8_t *input_addr, uint8_t byte, size_t lenght)
+{
+    __m512i key = _mm512_set1_epi8((char)byte);
+    for (; lenght >= 64; lenght -= 64, input_addr += 64)
+    {
+        uint64_t mask = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512((const void *)input_addr), key);
+        if (mask)
+            return input_addr + __builtin_ctzll(mask);
+    }
+    if (lenght) //The tail is one masked load, bytes past the end are not touched
+    {
+        uint64_t mask = _mm512_mask_cmpeq_epi8_mask((__mmask64)((1ull << lenght) - 1),
+                                                    _mm512_maskz_loadu_epi8((__mmask64)((1ull << lenght) - 1), input_addr), key);
+        if (mask)
+            return input_addr + __builtin_ctzll(mask);
+    }
+    return NULL;
+}
+#endif
+
+#ifdef RING_BUFFER_COPY_ARM
+/**
+ * \brief Find a byte 16 bytes at a time (private function)
+ * \param[in] input_addr: Start of the search
+ * \param[in] byte: Byte to find
+ * \param[in] lenght: Number of bytes to search
+ * \return Returns the address of the first match, NULL: not found
+*/
+static const uint8_t *Ring_Buffer_Find_NEON(const uint8_t *input_addr, uint8_t byte, size_t lenght)
+{
+    uint8x16_t key = vdupq_n_u8(byte);
+    for (; lenght >= 16; lenght -= 16, input_addr += 16)
+    {
+        uint8x16_t match = vceqq_u8(vld1q_u8(input_addr), key);
+        //Narrow each 0xFF / 0x00 lane to 4 bits, the 64-bit result has the first match in its lowest set nibble
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(match), 4)), 0);
+        if (mask)
+            return input_addr + (__builtin_ctzll(mask) >> 2);
+    }
+    for (; lenght; lenght--, input_addr++) //Tail shorter than one vector
+        if (*input_addr == byte)
+            return input_addr;
+    return NULL;
+}
+#endif
+
+static uint8_t copy_method = RING_BUFFER_COPY_GENERIC;
+static ring_buffer_copy_kernel copy_kernel = Ring_Buffer_Copy_Generic;
+static ring_buffer_find_kernel find_kernel = Ring_Buffer_Find_Generic;
+
+/**
+ * \brief Check that the CPU can run a kernel variant (private function)
+ * \param[in] method: RING_BUFFER_COPY_GENERIC / SSE2 / AVX2 / AVX512 / NEON
+ * \return Return 1: supported, 0: not supported
+*/
+static uint8_t Ring_Buffer_Copy_Supported(uint8_t method)
+{
+    switch (method)
+    {
+    case RING_BUFFER_COPY_GENERIC:
+        return 1;
+#ifdef RING_BUFFER_COPY_X86
+    case RING_BUFFER_COPY_SSE2:
+        return __builtin_cpu_supports("sse2") ? 1 : 0;
+    case RING_BUFFER_COPY_AVX2:
+        return __builtin_cpu_supports("avx2") ? 1 : 0;
+    case RING_BUFFER_COPY_AVX512:
+        return (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) ? 1 : 0;
+#endif
+#ifdef RING_BUFFER_COPY_ARM
+    case RING_BUFFER_COPY_NEON:
+        return 1; //Advanced SIMD is part of the AArch64 base architecture
+#endif
+    default:
+        return 0;
+    }
+}
+
+/**
+ * \brief Select the copy and search kernels
+ * \details Done once at load time, call it again before the buffers are in use to compare variants in one process;
+ * the kernels are shared by all buffers
+ * \param[in] method: RING_BUFFER_COPY_GENERIC / SSE2 / AVX2 / AVX512 / NEON
+ * \return Returns the result of the selection
+ *      \arg RING_BUFFER_SUCCESS: Selected
+ *      \arg RING_BUFFER_ERROR: Not supported by this CPU or this build, the current kernels are kept
+*/
+uint8_t Ring_Buffer_Copy_Set_Method(uint8_t method)
+{
+    if (!Ring_Buffer_Copy_Supported(method))
+        return RING_BUFFER_ERROR;
+    copy_kernel = Ring_Buffer_Copy_Generic;
+    find_kernel = Ring_Buffer_Find_Generic;
+    switch (method)
+    {
+#ifdef RING_BUFFER_COPY_X86
+    case RING_BUFFER_COPY_SSE2:
+        copy_kernel = Ring_Buffer_Copy_Stream_SSE2;
+        find_kernel = Ring_Buffer_Find_SSE2;
+        break;
+    case RING_BUFFER_COPY_AVX2:
+        copy_kernel = Ring_Buffer_Copy_Stream_AVX2;
+        find_kernel = Ring_Buffer_Find_AVX2;
+        break;
+    case RING_BUFFER_COPY_AVX512:
+        copy_kernel = Ring_Buffer_Copy_Stream_AVX512;
+        find_kernel = Ring_Buffer_Find_AVX512;
+        break;
+#endif
+#ifdef RING_BUFFER_COPY_ARM
+    case RING_BUFFER_COPY_NEON:
+        find_kernel = Ring_Buffer_Find_NEON; //Copies stay memcpy
+        break;
+#endif
+    default:
+        break;
+    }
+    copy_method = method;
+    return RING_BUFFER_SUCCESS;
+}
+
+#if defined(RING_BUFFER_COPY_X86) || defined(RING_BUFFER_COPY_ARM)
+/**
+ * \brief Pick the best kernels for this CPU before main runs, RING_BUFFER_KERNEL overrides the choice (private function)
+*/
+__attribute__((constructor)) static void Ring_Buffer_Copy_Select(void)
+{
+    static const char *const names[] = {"generic", "sse2", "avx2", "avx512", "neon"};
+    const char *kernel = getenv("RING_BUFFER_KERNEL");
+    uint8_t method;
+#ifdef RING_BUFFER_COPY_X86
+    __builtin_cpu_init(); //Constructors may run before the runtime has read the CPU features
+#endif
+    if (kernel != NULL)
+        for (method = 0; method < sizeof(names) / sizeof(names[0]); method++)
+            if (strcmp(kernel, names[method]) == 0 && Ring_Buffer_Copy_Set_Method(method) == RING_BUFFER_SUCCESS)
+                return;
+    //Widest variant first
+    for (method = RING_BUFFER_COPY_NEON + 1; method-- > RING_BUFFER_COPY_GENERIC;)
+        if (Ring_Buffer_Copy_Set_Method(method) == RING_BUFFER_SUCCESS)
+            return;
+}
+#endif
+
+/**
+ * \brief Get the kernel variant in use
+ * \return Return RING_BUFFER_COPY_GENERIC / SSE2 / AVX2 / AVX512 / NEON
+*/
+uint8_t Ring_Buffer_Copy_Get_Method(void)
+{
+    return copy_method;
+}
+
+/**
+ * \brief Set the size from which the large transfer path is used
+ * \details Set it before the buffers are in use, it is shared by all buffers;
+ * A good value is around the size of the L2 cache, bursts larger than that would evict it anyway
+ * \param[in] threshold: Copy size in bytes, 0: never use the large transfer path
+*/
+void Ring_Buffer_Copy_Set_Threshold(size_t threshold)
+{
+    if (threshold == 0)
+        copy_threshold = (size_t)-1;
+    else if (threshold < RING_BUFFER_COPY_MIN)
+        copy_threshold = RING_BUFFER_COPY_MIN;
+    else
+        copy_threshold = threshold;
+}
+
+/**
+ * \brief Copy data into a buffer array, copies from the threshold up bypass the cache with non-temporal stores
+ * \param[out] output_addr: Destination in the buffer array
+ * \param[in] input_addr: Source
+ * \param[in] lenght: Number of bytes
+*/
+void Ring_Buffer_Copy_In(void *output_addr, const void *input_addr, size_t lenght)
+{
+    if (lenght < copy_threshold)
+        memcpy(output_addr, input_addr, lenght);
+    else
+        copy_kernel((uint8_t *)output_addr, (const uint8_t *)input_addr, lenght);
+}
+
+/**
+ * \brief Copy data out of a buffer array, copies from the threshold up prefetch the next block while copying
+ * \details The data was written by another core (or streamed to memory), the prefetch starts the transfer
+ * of the next block before the copy reaches it
+ * \param[out] output_addr: Destination
+ * \param[in] input_addr: Source in the buffer array
+ * \param[in] lenght: Number of bytes
+*/
+void Ring_Buffer_Copy_Out(void *output_addr, const void *input_addr, size_t lenght)
+{
+    uint8_t *output = (uint8_t *)output_addr;
+    const uint8_t *input = (const uint8_t *)input_addr;
+    size_t i;
+    if (lenght >= copy_threshold)
+    {
+        for (; lenght > RING_BUFFER_COPY_BLOCK; lenght -= RING_BUFFER_COPY_BLOCK)
+        {
+            size_t ahead = lenght - RING_BUFFER_COPY_BLOCK; //Bytes after this block
+            if (ahead > RING_BUFFER_COPY_BLOCK)
+                ahead = RING_BUFFER_COPY_BLOCK;
+            for (i = 0; i < ahead; i += RING_BUFFER_COPY_LINE)
+                __builtin_prefetch(input + RING_BUFFER_COPY_BLOCK + i, 0, 0); //Read, no temporal locality
+            memcpy(output, input, RING_BUFFER_COPY_BLOCK);
+            output += RING_BUFFER_COPY_BLOCK;
+            input += RING_BUFFER_COPY_BLOCK;
+        }
+    }
+    memcpy(output, input, lenght);
+}
+
+/**
+ * \brief Find the first occurrence of a byte in a contiguous part of a buffer array
+ * \param[in] input_addr: Start of the search
+ * \param[in] byte: Byte to find
+ * \param[in] lenght: Number of bytes to search
+ * \return Returns the address of the first match, NULL: not found
+*/
+const uint8_t *Ring_Buffer_Copy_Find_Byte(const void *input_addr, uint8_t byte, size_t lenght)
+{
+    return find_kernel((const uint8_t *)input_addr, byte, lenght);
+}
@@ -0,0 +1,34 @@
+/**
+ * \file ring_buffer_copy.h
+ * \brief Ring buffer copy and search kernels correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.1.0
+*/
+
+#ifndef _RING_BUFFER_COPY_H_
+#define _RING_BUFFER_COPY_H_
+
+#include <stddef.h>
+#include "ring_buffer.h"
+
+// Default size from which a copy is treated as a large transfer, change at run time with Ring_Buffer_Copy_Set_Threshold
+#ifndef RING_BUFFER_COPY_THRESHOLD
+#define RING_BUFFER_COPY_THRESHOLD  (256u * 1024u)
+#endif
+
+// Kernel variants, selected at load time by CPU feature detection or by the RING_BUFFER_KERNEL environment variable
+#define RING_BUFFER_COPY_GENERIC    0x00 //"generic": memcpy / memchr
+#define RING_BUFFER_COPY_SSE2       0x01 //"sse2": 16-byte non-temporal stores (movntdq), 16-byte search
+#define RING_BUFFER_COPY_AVX2       0x02 //"avx2": 32-byte non-temporal stores (vmovntdq), 32-byte search
+#define RING_BUFFER_COPY_AVX512     0x03 //"avx512": 64-byte non-temporal stores, 64-byte search (AVX-512F / BW)
+#define RING_BUFFER_COPY_NEON       0x04 //"neon": memcpy, 16-byte search (AArch64)
+
+void Ring_Buffer_Copy_In(void *output_addr, const void *input_addr, size_t lenght);  //Copy data into a buffer array, large copies bypass the cache
+void Ring_Buffer_Copy_Out(void *output_addr, const void *input_addr, size_t lenght); //Copy data out of a buffer array, large copies prefetch ahead
+void Ring_Buffer_Copy_Set_Threshold(size_t threshold);                               //Set the size from which the large transfer path is used
+const uint8_t *Ring_Buffer_Copy_Find_Byte(const void *input_addr, uint8_t byte, size_t lenght); //Find the first occurrence of a byte in contiguous data
+uint8_t Ring_Buffer_Copy_Set_Method(uint8_t method);                                 //Select the copy and search kernels
+uint8_t Ring_Buffer_Copy_Get_Method(void);                                           //Get the kernel variant in use
+
+#endif
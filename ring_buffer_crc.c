@@ -0,0 +1,241 @@
+/**
+ * \file ring_buffer_crc.c
+ * \brief Ring buffer read / write with streaming checksum implementation
+ * \details The checksum is accumulated inside the copy of Ring_Buffer_Write_String_CRC / Ring_Buffer_Read_String_CRC,
+ * so a frame is checked without walking it again after it is extracted;
+ * CRC-32C uses the CRC32 instruction (x86 SSE4.2 / ARMv8 CRC) in the same loop that moves the data, 8 bytes per step;
+ * The table-driven types copy and checksum in small blocks, the block is still in L1 cache when it is checksummed;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.1
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+ * 2026.10.16 v1.0.1 Checksum tables are built at compile time, no lazy initialization race between threads
+*/
+
+#include "ring_buffer_crc.h"
+#include "ring_buffer_probes.h"
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+#define RING_BUFFER_CRC_BLOCK 256 //Block size of the table-driven copy, small enough to stay in L1 cache
+
+// One bit of the reflected CRC-32 / CRC-32C division and of the MSB-first CRC-16 division, branch-free so the
+// tables below are constant expressions, built by the compiler with no runtime initialization to race on
+#define RING_BUFFER_CRC_BIT(c, poly)    (((c) >> 1) ^ ((poly) & (0u - ((c) & 1u))))
+#define RING_BUFFER_CRC_BYTE(c, poly)   RING_BUFFER_CRC_BIT(RING_BUFFER_CRC_BIT(RING_BUFFER_CRC_BIT(RING_BUFFER_CRC_BIT( \
+                                        RING_BUFFER_CRC_BIT(RING_BUFFER_CRC_BIT(RING_BUFFER_CRC_BIT(RING_BUFFER_CRC_BIT( \
+                                        c, poly), poly), poly), poly), poly), poly), poly), poly)
+#define RING_BUFFER_CRC16_BIT(c)        ((((c) << 1) ^ (0x1021u & (0u - (((c) >> 15) & 1u)))) & 0xFFFFu)
+#define RING_BUFFER_CRC16_BYTE(c)       RING_BUFFER_CRC16_BIT(RING_BUFFER_CRC16_BIT(RING_BUFFER_CRC16_BIT(RING_BUFFER_CRC16_BIT( \
+                                        RING_BUFFER_CRC16_BIT(RING_BUFFER_CRC16_BIT(RING_BUFFER_CRC16_BIT(RING_BUFFER_CRC16_BIT( \
+                                        c))))))))
+#define RING_BUFFER_CRC32_ENTRY(i)      RING_BUFFER_CRC_BYTE((i), 0xEDB88320u)
+#define RING_BUFFER_CRC32C_ENTRY(i)     RING_BUFFER_CRC_BYTE((i), 0x82F63B78u)
+#define RING_BUFFER_CRC16_ENTRY(i)      (uint16_t)RING_BUFFER_CRC16_BYTE((i) << 8)
+#define RING_BUFFER_CRC_TABLE_4(m, i)   m(i), m((i) + 1u), m((i) + 2u), m((i) + 3u)
+#define RING_BUFFER_CRC_TABLE_16(m, i)  RING_BUFFER_CRC_TABLE_4(m, i), RING_BUFFER_CRC_TABLE_4(m, (i) + 4u), \
+                                        RING_BUFFER_CRC_TABLE_4(m, (i) + 8u), RING_BUFFER_CRC_TABLE_4(m, (i) + 12u)
+#define RING_BUFFER_CRC_TABLE_64(m, i)  RING_BUFFER_CRC_TABLE_16(m, i), RING_BUFFER_CRC_TABLE_16(m, (i) + 16u), \
+                                        RING_BUFFER_CRC_TABLE_16(m, (i) + 32u), RING_BUFFER_CRC_TABLE_16(m, (i) + 48u)
+#define RING_BUFFER_CRC_TABLE_256(m)    RING_BUFFER_CRC_TABLE_64(m, 0u), RING_BUFFER_CRC_TABLE_64(m, 64u), \
+                                        RING_BUFFER_CRC_TABLE_64(m, 128u), RING_BUFFER_CRC_TABLE_64(m, 192u)
+
+static const uint32_t crc32_table[256] = {RING_BUFFER_CRC_TABLE_256(RING_BUFFER_CRC32_ENTRY)};
+#if !defined(__SSE4_2__) && !defined(__ARM_FEATURE_CRC32)
+static const uint32_t crc32c_table[256] = {RING_BUFFER_CRC_TABLE_256(RING_BUFFER_CRC32C_ENTRY)};
+#endif
+static const uint16_t crc16_table[256] = {RING_BUFFER_CRC_TABLE_256(RING_BUFFER_CRC16_ENTRY)};
+
+/**
+ * \brief Start a new checksum
+ * \param[out] crc: Running checksum
+ * \param[in] type: RING_BUFFER_CRC32 / RING_BUFFER_CRC32C / RING_BUFFER_CRC16_CCITT
+*/
+void Ring_Buffer_CRC_Init(ring_buffer_crc *crc, uint8_t type)
+{
+    crc->type = type;
+    crc->value = (type == RING_BUFFER_CRC16_CCITT) ? 0xFFFFu : 0xFFFFFFFFu;
+}
+
+/**
+ * \brief Add data to the checksum
+ * \param[in,out] crc: Running checksum
+ * \param[in] data_addr: Data base address
+ * \param[in] data_lenght: Number of bytes
+*/
+void Ring_Buffer_CRC_Update(ring_buffer_crc *crc, const void *data_addr, uint32_t data_lenght)
+{
+    const uint8_t *data = (const uint8_t *)data_addr;
+    uint32_t value = crc->value;
+    if (crc->type == RING_BUFFER_CRC16_CCITT)
+    {
+        while (data_lenght--)
+            value = ((value << 8) ^ crc16_table[((value >> 8) ^ *data++) & 0xFF]) & 0xFFFF;
+    }
+    else if (crc->type == RING_BUFFER_CRC32C)
+    {
+#if defined(__SSE4_2__)
+        for (; data_lenght >= 8; data_lenght -= 8, data += 8)
+        {
+            uint64_t word;
+            memcpy(&word, data, 8);
+            value = (uint32_t)_mm_crc32_u64(value, word);
+        }
+        while (data_lenght--)
+            value = _mm_crc32_u8(value, *data++);
+#elif defined(__ARM_FEATURE_CRC32)
+        for (; data_lenght >= 8; data_lenght -= 8, data += 8)
+        {
+            uint64_t word;
+            memcpy(&word, data, 8);
+            value = __crc32cd(value, word);
+        }
+        while (data_lenght--)
+            value = __crc32cb(value, *data++);
+#else
+        while (data_lenght--)
+            value = (value >> 8) ^ crc32c_table[(value ^ *data++) & 0xFF];
+#endif
+    }
+    else
+    {
+        while (data_lenght--)
+            value = (value >> 8) ^ crc32_table[(value ^ *data++) & 0xFF];
+    }
+    crc->value = value;
+}
+
+/**
+ * \brief Get the final checksum, the running checksum can still be updated afterwards
+ * \param[in] crc: Running checksum
+ * \return Return the checksum of all data added since Ring_Buffer_CRC_Init
+*/
+uint32_t Ring_Buffer_CRC_Get(ring_buffer_crc *crc)
+{
+    if (crc->type == RING_BUFFER_CRC16_CCITT)
+        return crc->value;
+    return crc->value ^ 0xFFFFFFFFu;
+}
+
+/**
+ * \brief Copy data and add it to the checksum in the same pass (private function)
+ * \param[out] output_addr: Destination
+ * \param[in] input_addr: Source
+ * \param[in] lenght: Number of bytes
+ * \param[in,out] crc: Running checksum
+*/
+static void Ring_Buffer_CRC_Copy(uint8_t *output_addr, const uint8_t *input_addr, uint32_t lenght, ring_buffer_crc *crc)
+{
+#if defined(__SSE4_2__) || defined(__ARM_FEATURE_CRC32)
+    if (crc->type == RING_BUFFER_CRC32C) //Each word is loaded once, stored and fed to the CRC instruction
+    {
+        uint32_t value = crc->value;
+        for (; lenght >= 8; lenght -= 8, input_addr += 8, output_addr += 8)
+        {
+            uint64_t word;
+            memcpy(&word, input_addr, 8);
+            memcpy(output_addr, &word, 8);
+#if defined(__SSE4_2__)
+            value = (uint32_t)_mm_crc32_u64(value, word);
+#else
+            value = __crc32cd(value, word);
+#endif
+        }
+        crc->value = value;
+        memcpy(output_addr, input_addr, lenght);
+        Ring_Buffer_CRC_Update(crc, output_addr, lenght);
+        return;
+    }
+#endif
+    while (lenght != 0)
+    {
+        uint32_t block = (lenght > RING_BUFFER_CRC_BLOCK) ? RING_BUFFER_CRC_BLOCK : lenght;
+        memcpy(output_addr, input_addr, block);
+        Ring_Buffer_CRC_Update(crc, output_addr, block); //Block was just written, it is still in L1 cache
+        output_addr += block;
+        input_addr += block;
+        lenght -= block;
+    }
+}
+
+/**
+ * \brief Write the data of the specified length to the tail of the buffer and add it to the checksum
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] input_addr: Base site to be written to
+ * \param[in] write_lenght: Number of bytes to be written
+ * \param[in,out] crc: Running checksum
+ * \return Returns the result of the write
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure, the checksum is not changed
+*/
+uint8_t Ring_Buffer_Write_String_CRC(ring_buffer *ring_buffer_handle, const void *input_addr, uint32_t write_lenght, ring_buffer_crc *crc)
+{
+    uint32_t write_size_a;
+    if (write_lenght > Ring_Buffer_Get_FreeSize(ring_buffer_handle))
+    {
+        RING_BUFFER_STATS_REJECT(ring_buffer_handle);
+        RING_BUFFER_PROBE(write_full, ring_buffer_handle, write_lenght);
+        return RING_BUFFER_ERROR;
+    }
+    write_size_a = ring_buffer_handle->max_length - ring_buffer_handle->tail;
+    if (write_size_a >= write_lenght)
+    {
+        Ring_Buffer_CRC_Copy(ring_buffer_handle->array_addr + ring_buffer_handle->tail, (const uint8_t *)input_addr, write_lenght, crc);
+        ring_buffer_handle->tail += write_lenght;
+        if (ring_buffer_handle->tail == ring_buffer_handle->max_length)
+            ring_buffer_handle->tail = 0;
+    }
+    else //Need to write twice
+    {
+        Ring_Buffer_CRC_Copy(ring_buffer_handle->array_addr + ring_buffer_handle->tail, (const uint8_t *)input_addr, write_size_a, crc);
+        Ring_Buffer_CRC_Copy(ring_buffer_handle->array_addr, (const uint8_t *)input_addr + write_size_a, write_lenght - write_size_a, crc);
+        ring_buffer_handle->tail = write_lenght - write_size_a;
+    }
+    RING_BUFFER_LENGTH_ADD(ring_buffer_handle, write_lenght);
+    RING_BUFFER_STATS_WRITE(ring_buffer_handle, write_lenght, write_size_a < write_lenght);
+    RING_BUFFER_TRACE_WRITE(ring_buffer_handle, write_lenght);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Read the data of the specified length from the buffer header and add it to the checksum
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] output_addr: Read data saved address
+ * \param[in] read_lenght: Number of bytes to read
+ * \param[in,out] crc: Running checksum
+ * \return Returns the result of the read
+ *      \arg RING_BUFFER_SUCCESS: Read success
+ *      \arg RING_BUFFER_ERROR: Read failure, the checksum is not changed
+*/
+uint8_t Ring_Buffer_Read_String_CRC(ring_buffer *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght, ring_buffer_crc *crc)
+{
+    uint32_t read_size_a;
+    if (read_lenght > RING_BUFFER_LENGTH(ring_buffer_handle))
+    {
+        RING_BUFFER_PROBE(read_empty, ring_buffer_handle, read_lenght);
+        return RING_BUFFER_ERROR;
+    }
+    read_size_a = ring_buffer_handle->max_length - ring_buffer_handle->head;
+    if (read_size_a >= read_lenght)
+    {
+        Ring_Buffer_CRC_Copy(output_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head, read_lenght, crc);
+        ring_buffer_handle->head += read_lenght;
+        if (ring_buffer_handle->head == ring_buffer_handle->max_length)
+            ring_buffer_handle->head = 0;
+    }
+    else //Need to read twice
+    {
+        Ring_Buffer_CRC_Copy(output_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head, read_size_a, crc);
+        Ring_Buffer_CRC_Copy(output_addr + read_size_a, ring_buffer_handle->array_addr, read_lenght - read_size_a, crc);
+        ring_buffer_handle->head = read_lenght - read_size_a;
+    }
+    RING_BUFFER_LENGTH_SUB(ring_buffer_handle, read_lenght);
+    RING_BUFFER_STATS_READ(ring_buffer_handle, read_lenght, read_size_a < read_lenght);
+    RING_BUFFER_TRACE_READ(ring_buffer_handle, read_lenght);
+    return RING_BUFFER_SUCCESS;
+}
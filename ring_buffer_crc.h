@@ -0,0 +1,32 @@
+/**
+ * \file ring_buffer_crc.h
+ * \brief Ring buffer read / write with streaming checksum correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_CRC_H_
+#define _RING_BUFFER_CRC_H_
+
+#include "ring_buffer.h"
+
+// Checksum type
+#define RING_BUFFER_CRC32           0x00 //CRC-32 (IEEE 802.3, reflected 0x04C11DB7, init / xorout 0xFFFFFFFF)
+#define RING_BUFFER_CRC32C          0x01 //CRC-32C (Castagnoli, reflected 0x1EDC6F41, init / xorout 0xFFFFFFFF), hardware CRC32 instruction when available
+#define RING_BUFFER_CRC16_CCITT     0x02 //CRC-16/CCITT-FALSE (0x1021, init 0xFFFF, no xorout)
+
+// Running checksum, one per frame, can be fed by several reads / writes
+typedef struct
+{
+    uint8_t type;   //RING_BUFFER_CRCxx
+    uint32_t value; //Running register, use Ring_Buffer_CRC_Get for the final value
+} ring_buffer_crc;
+
+void Ring_Buffer_CRC_Init(ring_buffer_crc *crc, uint8_t type);                                                                                //Start a new checksum
+void Ring_Buffer_CRC_Update(ring_buffer_crc *crc, const void *data_addr, uint32_t data_lenght);                                               //Add data to the checksum
+uint32_t Ring_Buffer_CRC_Get(ring_buffer_crc *crc);                                                                                           //Get the final checksum
+uint8_t Ring_Buffer_Write_String_CRC(ring_buffer *ring_buffer_handle, const void *input_addr, uint32_t write_lenght, ring_buffer_crc *crc);  //Write the specified length data to the buffer and add it to the checksum
+uint8_t Ring_Buffer_Read_String_CRC(ring_buffer *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght, ring_buffer_crc *crc);     //Read the specified length data from the buffer and add it to the checksum
+
+#endif
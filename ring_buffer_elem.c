@@ -0,0 +1,214 @@
+/**
+ * \file ring_buffer_elem.c
+ * \brief Fixed-size element ring buffer implementation
+ * \details Stores structures of a fixed size set at initialization, all pointers count elements instead of bytes;
+ * An element is never split by the end of the array, so single element access is one memcpy of elem_size;
+ * Bulk write / read of K elements is at most two memcpy, one before and one after the wrap point;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.1.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+ * 2026.10.16 v1.1.0 Add Ring_Buffer_Elem_Peek, random access to stored elements (e.g. binary search)
+*/
+
+#include "ring_buffer_elem.h"
+
+/**
+ * \brief Initialization new element buffer
+ * \param[out] ring_buffer_handle: Buffer structure handle to be initialized
+ * \param[in] buffer_addr: Array of external definitions, at least elem_size * elem_count bytes
+ * \param[in] elem_size: Size of one element in bytes
+ * \param[in] elem_count: Number of elements the buffer array can hold
+ * \return Returns the result of the buffer initialization
+ *      \arg RING_BUFFER_SUCCESS: Initialization successful
+ *      \arg RING_BUFFER_ERROR: initialization failed
+*/
+uint8_t Ring_Buffer_Elem_Init(ring_buffer_elem *ring_buffer_handle, void *buffer_addr, uint32_t elem_size, uint32_t elem_count)
+{
+    ring_buffer_handle->head = 0;                            //Reset head pointer
+    ring_buffer_handle->tail = 0;                            //Reset tail pointer
+    ring_buffer_handle->lenght = 0;                          //Reset has stored element count
+    ring_buffer_handle->array_addr = (uint8_t *)buffer_addr; //Buffer storage number base address
+    ring_buffer_handle->max_length = elem_count;             //Buffer maximum storage element count
+    ring_buffer_handle->elem_size = elem_size;               //Size of one element
+    if (elem_size == 0 || elem_count == 0)                   //Need at least one element of at least one byte
+        return RING_BUFFER_ERROR;
+    else
+        return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Write one element to the end of the buffer
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] input_addr: Address of the element to be written
+ * \return Returns the result of the buffer write element
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure
+*/
+uint8_t Ring_Buffer_Elem_Write(ring_buffer_elem *ring_buffer_handle, const void *input_addr)
+{
+    if (ring_buffer_handle->lenght == ring_buffer_handle->max_length)
+        return RING_BUFFER_ERROR; //The buffer is full
+    memcpy(ring_buffer_handle->array_addr + ring_buffer_handle->tail * ring_buffer_handle->elem_size, input_addr, ring_buffer_handle->elem_size);
+    ring_buffer_handle->lenght++;
+    ring_buffer_handle->tail++;
+    if (ring_buffer_handle->tail == ring_buffer_handle->max_length)
+        ring_buffer_handle->tail = 0; //Tail pointer reaches the end of the array, return to the beginning
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Read one element from the buffer head pointer
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] output_addr: Address to save the element
+ * \return Returns the result of the buffer read element
+ *      \arg RING_BUFFER_SUCCESS: Read success
+ *      \arg RING_BUFFER_ERROR: Read failure
+*/
+uint8_t Ring_Buffer_Elem_Read(ring_buffer_elem *ring_buffer_handle, void *output_addr)
+{
+    if (ring_buffer_handle->lenght == 0)
+        return RING_BUFFER_ERROR; //The buffer is empty
+    memcpy(output_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head * ring_buffer_handle->elem_size, ring_buffer_handle->elem_size);
+    ring_buffer_handle->lenght--;
+    ring_buffer_handle->head++;
+    if (ring_buffer_handle->head == ring_buffer_handle->max_length)
+        ring_buffer_handle->head = 0; //Head pointer reaches the end of the array, return to the beginning
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Write the specified number of elements to the tail of the buffer
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] input_addr: Base address of the continuous elements to be written
+ * \param[in] elem_count: Number of elements to be written
+ * \return Returns the result of the buffer write elements
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure, nothing is written
+*/
+uint8_t Ring_Buffer_Elem_Write_Multi(ring_buffer_elem *ring_buffer_handle, const void *input_addr, uint32_t elem_count)
+{
+    uint32_t write_count_a, write_count_b;
+    if (elem_count > (ring_buffer_handle->max_length - ring_buffer_handle->lenght))
+        return RING_BUFFER_ERROR; //Not enough space to store all elements
+    //Elements from the tail pointer to the end of the array, the rest is written from the beginning
+    write_count_a = ring_buffer_handle->max_length - ring_buffer_handle->tail;
+    if (write_count_a > elem_count)
+        write_count_a = elem_count;
+    write_count_b = elem_count - write_count_a;
+    memcpy(ring_buffer_handle->array_addr + ring_buffer_handle->tail * ring_buffer_handle->elem_size,
+           input_addr, write_count_a * ring_buffer_handle->elem_size);
+    if (write_count_b != 0) //Need to write twice
+    {
+        memcpy(ring_buffer_handle->array_addr, (const uint8_t *)input_addr + write_count_a * ring_buffer_handle->elem_size,
+               write_count_b * ring_buffer_handle->elem_size);
+        ring_buffer_handle->tail = write_count_b; //Repositioning the tail pointer position
+    }
+    else
+    {
+        ring_buffer_handle->tail += write_count_a; //Repositioning the tail pointer position
+        if (ring_buffer_handle->tail == ring_buffer_handle->max_length)
+            ring_buffer_handle->tail = 0;
+    }
+    ring_buffer_handle->lenght += elem_count; //How many elements are recorded
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Read the specified number of elements from the buffer head, save to the specified address
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] output_addr: Address to save the continuous elements
+ * \param[in] elem_count: Number of elements to read
+ * \return Returns the result of the buffer read elements
+ *      \arg RING_BUFFER_SUCCESS: Read success
+ *      \arg RING_BUFFER_ERROR: Read failure, nothing is read
+*/
+uint8_t Ring_Buffer_Elem_Read_Multi(ring_buffer_elem *ring_buffer_handle, void *output_addr, uint32_t elem_count)
+{
+    uint32_t read_count_a, read_count_b;
+    if (elem_count > ring_buffer_handle->lenght)
+        return RING_BUFFER_ERROR; //Not enough elements stored
+    read_count_a = ring_buffer_handle->max_length - ring_buffer_handle->head;
+    if (read_count_a > elem_count)
+        read_count_a = elem_count;
+    read_count_b = elem_count - read_count_a;
+    memcpy(output_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head * ring_buffer_handle->elem_size,
+           read_count_a * ring_buffer_handle->elem_size);
+    if (read_count_b != 0) //Need to read twice
+    {
+        memcpy((uint8_t *)output_addr + read_count_a * ring_buffer_handle->elem_size, ring_buffer_handle->array_addr,
+               read_count_b * ring_buffer_handle->elem_size);
+        ring_buffer_handle->head = read_count_b; //Repositioning head pointer position
+    }
+    else
+    {
+        ring_buffer_handle->head += read_count_a; //Repositioning head pointer position
+        if (ring_buffer_handle->head == ring_buffer_handle->max_length)
+            ring_buffer_handle->head = 0;
+    }
+    ring_buffer_handle->lenght -= elem_count; //Record the amount of remaining elements
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Delete the specified number of elements from the head pointer
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] elem_count: Number of elements to delete
+ * \return Return to delete the specified number of elements result
+ *      \arg RING_BUFFER_SUCCESS: successfully deleted
+ *      \arg RING_BUFFER_ERROR: failed to delete
+*/
+uint8_t Ring_Buffer_Elem_Delete(ring_buffer_elem *ring_buffer_handle, uint32_t elem_count)
+{
+    if (ring_buffer_handle->lenght < elem_count)
+        return RING_BUFFER_ERROR; //Fewer elements stored than need to be deleted
+    if (elem_count >= (ring_buffer_handle->max_length - ring_buffer_handle->head))
+        ring_buffer_handle->head = elem_count - (ring_buffer_handle->max_length - ring_buffer_handle->head);
+    else
+        ring_buffer_handle->head += elem_count; //Head pointer advances forward, abandon elements
+    ring_buffer_handle->lenght -= elem_count;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Copy a stored element without removing it
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] index: Element position from the head pointer, 0 is the oldest element
+ * \param[out] output_addr: Read element saved address, at least elem_size bytes
+ * \return Returns the result of the copy
+ *      \arg RING_BUFFER_SUCCESS: Copy success
+ *      \arg RING_BUFFER_ERROR: Copy failure, index is not less than the stored element count
+*/
+uint8_t Ring_Buffer_Elem_Peek(ring_buffer_elem *ring_buffer_handle, uint32_t index, void *output_addr)
+{
+    uint32_t position;
+    if (index >= ring_buffer_handle->lenght)
+        return RING_BUFFER_ERROR;
+    if (index >= ring_buffer_handle->max_length - ring_buffer_handle->head) //Compare without adding, head + index can exceed 32 bits
+        position = index - (ring_buffer_handle->max_length - ring_buffer_handle->head);
+    else
+        position = ring_buffer_handle->head + index;
+    memcpy(output_addr, ring_buffer_handle->array_addr + position * ring_buffer_handle->elem_size, ring_buffer_handle->elem_size);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Get the element count that has been stored in the buffer
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \return Returns the number of elements already stored in the buffer
+*/
+uint32_t Ring_Buffer_Elem_Get_Length(ring_buffer_elem *ring_buffer_handle)
+{
+    return ring_buffer_handle->lenght;
+}
+
+/**
+ * \brief Get the element count the buffer can still store
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \return Return to buffer available element count
+*/
+uint32_t Ring_Buffer_Elem_Get_FreeSize(ring_buffer_elem *ring_buffer_handle)
+{
+    return (ring_buffer_handle->max_length - ring_buffer_handle->lenght);
+}
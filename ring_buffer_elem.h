@@ -0,0 +1,35 @@
+/**
+ * \file ring_buffer_elem.h
+ * \brief Fixed-size element ring buffer correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_ELEM_H_
+#define _RING_BUFFER_ELEM_H_
+
+#include "ring_buffer.h"
+
+// Element ring buffer structure, all pointers and lengths count elements instead of bytes
+typedef struct
+{
+    uint32_t head;       //Operating head pointer (element index)
+    uint32_t tail;       //Operate tail pointer (element index)
+    uint32_t lenght;     //Saved element count
+    uint8_t *array_addr; //Buffer storage number base address
+    uint32_t max_length; //Buffer maximum storage element count
+    uint32_t elem_size;  //Size of one element in bytes
+} ring_buffer_elem;
+
+uint8_t Ring_Buffer_Elem_Init(ring_buffer_elem *ring_buffer_handle, void *buffer_addr, uint32_t elem_size, uint32_t elem_count); //Initialization new element buffer
+uint8_t Ring_Buffer_Elem_Write(ring_buffer_elem *ring_buffer_handle, const void *input_addr);                                    //Write one element to the buffer
+uint8_t Ring_Buffer_Elem_Read(ring_buffer_elem *ring_buffer_handle, void *output_addr);                                          //Read one element from the buffer
+uint8_t Ring_Buffer_Elem_Write_Multi(ring_buffer_elem *ring_buffer_handle, const void *input_addr, uint32_t elem_count);         //Write the specified number of elements to the buffer
+uint8_t Ring_Buffer_Elem_Read_Multi(ring_buffer_elem *ring_buffer_handle, void *output_addr, uint32_t elem_count);               //Read the specified number of elements from the buffer
+uint8_t Ring_Buffer_Elem_Delete(ring_buffer_elem *ring_buffer_handle, uint32_t elem_count);                                      //Delete the specified number of elements from the head pointer
+uint8_t Ring_Buffer_Elem_Peek(ring_buffer_elem *ring_buffer_handle, uint32_t index, void *output_addr);                          //Copy a stored element without removing it
+uint32_t Ring_Buffer_Elem_Get_Length(ring_buffer_elem *ring_buffer_handle);                                                      //Get the element count that has been stored in the buffer
+uint32_t Ring_Buffer_Elem_Get_FreeSize(ring_buffer_elem *ring_buffer_handle);                                                    //Get the element count the buffer can still store
+
+#endif
@@ -0,0 +1,304 @@
+/**
+ * \file ring_buffer_file.c
+ * \brief File-backed persistent ring buffer implementation (POSIX)
+ * \details The buffer data and the head / tail pointers live in a shared mmap of a file with a small header;
+ * When the process restarts, opening the same file re-attaches to the buffer and reading resumes where it stopped;
+ * The mapping is shared, so the data survives a process crash as soon as it is written, msync policy only decides
+ * how much is lost on power failure and how much the durability costs;
+ * Data is always written before the pointers are saved, a torn update loses the newest data but never exposes garbage;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.2.3
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+ * 2026.10.16 v1.1.0 Delete takes a 32-bit length
+ * 2026.10.16 v1.1.1 Reject a header whose head, tail and data volume do not agree
+ * 2026.10.16 v1.2.0 msync only the pages written since the last msync instead of the whole mapping
+ * 2026.10.16 v1.2.1 Define _GNU_SOURCE so ftruncate is declared under -std=c11
+ * 2026.10.16 v1.2.2 Clear the operation counters on open
+ * 2026.10.16 v1.2.3 Open initializes the ring with Ring_Buffer_Init, a traced build no longer reads a stale trace pointer
+*/
+
+#define _GNU_SOURCE
+#include "ring_buffer_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define RING_BUFFER_FILE_VERSION 1
+
+/**
+ * \brief Get the tail pointer the saved head pointer and data volume lead to (private function)
+ * \details A header whose tail pointer differs was torn or edited, its pointers would expose stale bytes as data;
+ * With RING_BUFFER_EMPTY_SLOT the saved data volume is the one derived from head / tail when it was saved,
+ * and at most max_length - 1, so the same check holds
+ * \param[in] header: File header, head and lenght already checked against max_length
+ * \return Return the expected tail pointer
+*/
+static uint32_t Ring_Buffer_File_Tail(const ring_buffer_file_header *header)
+{
+    if (header->lenght >= header->max_length - header->head) //Compare without adding, head + lenght can exceed 32 bits
+        return header->lenght - (header->max_length - header->head);
+    return header->head + header->lenght;
+}
+
+/**
+ * \brief Add the data written since the last commit to the range waiting for msync (private function)
+ * \param[in] ring_buffer_handle: Buffer handle
+ * \param[in] data_changed: Non-zero if data was written, an unchanged tail pointer then means a whole lap
+*/
+static void Ring_Buffer_File_Track(ring_buffer_file *ring_buffer_handle, uint8_t data_changed)
+{
+    ring_buffer *ring = &ring_buffer_handle->ring;
+    uint32_t distance = ring->tail >= ring_buffer_handle->commit_tail ? ring->tail - ring_buffer_handle->commit_tail
+                                                                      : ring->max_length - ring_buffer_handle->commit_tail + ring->tail;
+    if (distance == 0 && data_changed)
+        distance = ring->max_length;
+    if (distance > ring->max_length - ring_buffer_handle->dirty_lenght)
+        ring_buffer_handle->dirty_lenght = ring->max_length; //Every byte of the array was written
+    else
+        ring_buffer_handle->dirty_lenght += distance;
+    ring_buffer_handle->commit_tail = ring->tail;
+}
+
+/**
+ * \brief msync a range of the mapping rounded out to whole pages (private function)
+ * \param[in] ring_buffer_handle: Buffer handle
+ * \param[in] offset: Start of the range from the start of the mapping
+ * \param[in] size: Size of the range
+ * \return Return 0: success, -1: msync failed
+*/
+static int Ring_Buffer_File_Msync(ring_buffer_file *ring_buffer_handle, size_t offset, size_t size)
+{
+    size_t page_mask = (size_t)sysconf(_SC_PAGESIZE) - 1;
+    size_t start = offset & ~page_mask;
+    return msync((uint8_t *)ring_buffer_handle->header + start, offset + size - start, MS_SYNC);
+}
+
+/**
+ * \brief msync the data written since the last msync, not the whole array (private function)
+ * \param[in] ring_buffer_handle: Buffer handle
+ * \return Return 0: success, -1: msync failed
+*/
+static int Ring_Buffer_File_Flush(ring_buffer_file *ring_buffer_handle)
+{
+    ring_buffer *ring = &ring_buffer_handle->ring;
+    uint32_t dirty = ring_buffer_handle->dirty_lenght, start;
+    int result = 0;
+    if (dirty == 0)
+        return 0;
+    ring_buffer_handle->dirty_lenght = 0;
+    if (dirty >= ring->max_length)
+        return Ring_Buffer_File_Msync(ring_buffer_handle, RING_BUFFER_FILE_HEADER_SIZE, ring->max_length);
+    //The dirty bytes end at the tail pointer, one range or two when they wrap
+    start = dirty > ring->tail ? ring->max_length - (dirty - ring->tail) : ring->tail - dirty;
+    if (dirty > ring->max_length - start)
+    {
+        result = Ring_Buffer_File_Msync(ring_buffer_handle, RING_BUFFER_FILE_HEADER_SIZE + (size_t)start, ring->max_length - start);
+        dirty -= ring->max_length - start;
+        start = 0;
+    }
+    if (Ring_Buffer_File_Msync(ring_buffer_handle, RING_BUFFER_FILE_HEADER_SIZE + (size_t)start, dirty) != 0)
+        result = -1;
+    return result;
+}
+
+/**
+ * \brief Create or re-attach a file-backed buffer
+ * \param[out] ring_buffer_handle: Buffer handle to be initialized
+ * \param[in] path: Backing file path, created if it does not exist
+ * \param[in] buffer_size: Buffer size of a new file, must match an existing file, 0 takes the size of an existing file
+ * \param[in] sync_policy: RING_BUFFER_FILE_SYNC_xxx
+ * \param[in] sync_interval: Operations between two msync for RING_BUFFER_FILE_SYNC_INTERVAL
+ * \return Returns the result of the buffer initialization
+ *      \arg RING_BUFFER_SUCCESS: Initialization successful, stored data of an existing file is readable again
+ *      \arg RING_BUFFER_ERROR: initialization failed (file error, size mismatch or damaged header)
+*/
+uint8_t Ring_Buffer_File_Open(ring_buffer_file *ring_buffer_handle, const char *path, uint32_t buffer_size, uint8_t sync_policy, uint32_t sync_interval)
+{
+    struct stat file_stat;
+    ring_buffer_file_header *header;
+    void *map_addr;
+    uint8_t new_file;
+    ring_buffer_handle->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (ring_buffer_handle->fd < 0)
+        return RING_BUFFER_ERROR;
+    if (fstat(ring_buffer_handle->fd, &file_stat) != 0)
+        goto fail_close;
+    new_file = (file_stat.st_size == 0);
+    if (new_file) //New file, make room for header + data
+    {
+        if (buffer_size < 2 || ftruncate(ring_buffer_handle->fd, RING_BUFFER_FILE_HEADER_SIZE + (off_t)buffer_size) != 0)
+            goto fail_close;
+        ring_buffer_handle->map_size = RING_BUFFER_FILE_HEADER_SIZE + (size_t)buffer_size;
+    }
+    else
+        ring_buffer_handle->map_size = (size_t)file_stat.st_size;
+    if (ring_buffer_handle->map_size < RING_BUFFER_FILE_HEADER_SIZE + 2)
+        goto fail_close;
+    map_addr = mmap(NULL, ring_buffer_handle->map_size, PROT_READ | PROT_WRITE, MAP_SHARED, ring_buffer_handle->fd, 0);
+    if (map_addr == MAP_FAILED)
+        goto fail_close;
+    header = (ring_buffer_file_header *)map_addr;
+    if (new_file)
+    {
+        header->head = 0;
+        header->tail = 0;
+        header->lenght = 0;
+        header->max_length = buffer_size;
+        header->version = RING_BUFFER_FILE_VERSION;
+        header->magic = RING_BUFFER_FILE_MAGIC; //Magic last, a file without it is never attached
+        msync(map_addr, ring_buffer_handle->map_size, MS_SYNC);
+    }
+    else //Existing file, check the header before trusting the pointers
+    {
+        if (header->magic != RING_BUFFER_FILE_MAGIC || header->version != RING_BUFFER_FILE_VERSION ||
+            (buffer_size != 0 && header->max_length != buffer_size) ||
+            header->max_length < 2 || header->max_length > ring_buffer_handle->map_size - RING_BUFFER_FILE_HEADER_SIZE ||
+            header->head >= header->max_length || header->tail >= header->max_length || header->lenght > header->max_length - RING_BUFFER_RESERVED ||
+            Ring_Buffer_File_Tail(header) != header->tail)
+        {
+            munmap(map_addr, ring_buffer_handle->map_size);
+            goto fail_close;
+        }
+    }
+    ring_buffer_handle->header = header;
+    //Init clears every optional field (trace, stats), then the pointers saved in the file are restored
+    Ring_Buffer_Init(&ring_buffer_handle->ring, (uint8_t *)map_addr + RING_BUFFER_FILE_HEADER_SIZE, header->max_length);
+    ring_buffer_handle->ring.head = header->head;
+    ring_buffer_handle->ring.tail = header->tail;
+#ifndef RING_BUFFER_EMPTY_SLOT
+    ring_buffer_handle->ring.lenght = header->lenght;
+#endif
+#ifdef RING_BUFFER_STATS
+    Ring_Buffer_Reset_Stats(&ring_buffer_handle->ring); //Counters start from zero, occupancy from the re-attached data
+#endif
+    ring_buffer_handle->sync_policy = sync_policy;
+    ring_buffer_handle->sync_interval = sync_interval ? sync_interval : 1;
+    ring_buffer_handle->sync_count = 0;
+    ring_buffer_handle->commit_tail = ring_buffer_handle->ring.tail;
+    ring_buffer_handle->dirty_lenght = 0;
+    return RING_BUFFER_SUCCESS;
+fail_close:
+    close(ring_buffer_handle->fd);
+    ring_buffer_handle->fd = -1;
+    return RING_BUFFER_ERROR;
+}
+
+/**
+ * \brief Save the pointers to the file header, and msync according to the policy
+ * \details Call it after using Ring_Buffer_xxx functions directly on ring_buffer_handle->ring,
+ * at least once every max_length written bytes so the range waiting for msync stays known
+ * \param[in] ring_buffer_handle: Buffer handle
+ * \param[in] data_changed: Non-zero if data was written, it is synced before the pointers that make it visible
+*/
+void Ring_Buffer_File_Commit(ring_buffer_file *ring_buffer_handle, uint8_t data_changed)
+{
+    uint8_t sync = 0;
+    if (ring_buffer_handle->sync_policy == RING_BUFFER_FILE_SYNC_ALWAYS)
+        sync = 1;
+    else if (ring_buffer_handle->sync_policy == RING_BUFFER_FILE_SYNC_INTERVAL &&
+             ++ring_buffer_handle->sync_count >= ring_buffer_handle->sync_interval)
+        sync = 1;
+    Ring_Buffer_File_Track(ring_buffer_handle, data_changed);
+    if (sync) //Data reaches the disk before the tail pointer that covers it, only the pages written since the last msync
+        Ring_Buffer_File_Flush(ring_buffer_handle);
+    ring_buffer_handle->header->head = ring_buffer_handle->ring.head;
+    ring_buffer_handle->header->tail = ring_buffer_handle->ring.tail;
+    ring_buffer_handle->header->lenght = RING_BUFFER_LENGTH(&ring_buffer_handle->ring);
+    if (sync) //Header is at the start of the mapping, one page is enough
+    {
+        msync(ring_buffer_handle->header, RING_BUFFER_FILE_HEADER_SIZE, MS_SYNC);
+        ring_buffer_handle->sync_count = 0;
+    }
+}
+
+/**
+ * \brief Write the data of the specified length to the tail of the buffer
+ * \param[in] ring_buffer_handle: Buffer handle
+ * \param[in] input_addr: Base site to be written to
+ * \param[in] write_lenght: Number of bytes to be written
+ * \return Returns the result of the write
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure
+*/
+uint8_t Ring_Buffer_File_Write_String(ring_buffer_file *ring_buffer_handle, void *input_addr, uint32_t write_lenght)
+{
+    if (Ring_Buffer_Write_String(&ring_buffer_handle->ring, input_addr, write_lenght) == RING_BUFFER_ERROR)
+        return RING_BUFFER_ERROR;
+    Ring_Buffer_File_Commit(ring_buffer_handle, write_lenght != 0);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Read the data of the specified length from the buffer header
+ * \param[in] ring_buffer_handle: Buffer handle
+ * \param[out] output_addr: Read data saved address
+ * \param[in] read_lenght: Number of bytes to read
+ * \return Returns the result of the read
+ *      \arg RING_BUFFER_SUCCESS: Read success
+ *      \arg RING_BUFFER_ERROR: Read failure
+*/
+uint8_t Ring_Buffer_File_Read_String(ring_buffer_file *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght)
+{
+    if (Ring_Buffer_Read_String(&ring_buffer_handle->ring, output_addr, read_lenght) == RING_BUFFER_ERROR)
+        return RING_BUFFER_ERROR;
+    Ring_Buffer_File_Commit(ring_buffer_handle, 0);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Delete data from the head pointer to the specified length
+ * \param[in] ring_buffer_handle: Buffer handle
+ * \param[in] lenght: To delete the length
+ * \return Return to delete the specified length data result
+ *      \arg RING_BUFFER_SUCCESS: successfully deleted
+ *      \arg RING_BUFFER_ERROR: failed to delete
+*/
+uint8_t Ring_Buffer_File_Delete(ring_buffer_file *ring_buffer_handle, uint32_t lenght)
+{
+    if (Ring_Buffer_Delete(&ring_buffer_handle->ring, lenght) == RING_BUFFER_ERROR)
+        return RING_BUFFER_ERROR;
+    Ring_Buffer_File_Commit(ring_buffer_handle, 0);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief msync the data written since the last msync and the pointers now, regardless of the policy
+ * \param[in] ring_buffer_handle: Buffer handle
+ * \return Return the sync result
+ *      \arg RING_BUFFER_SUCCESS: Data and pointers are on disk
+ *      \arg RING_BUFFER_ERROR: msync failed
+*/
+uint8_t Ring_Buffer_File_Sync(ring_buffer_file *ring_buffer_handle)
+{
+    int result;
+    Ring_Buffer_File_Track(ring_buffer_handle, 0);
+    result = Ring_Buffer_File_Flush(ring_buffer_handle); //Data before the pointers that make it visible
+    ring_buffer_handle->header->head = ring_buffer_handle->ring.head;
+    ring_buffer_handle->header->tail = ring_buffer_handle->ring.tail;
+    ring_buffer_handle->header->lenght = RING_BUFFER_LENGTH(&ring_buffer_handle->ring);
+    ring_buffer_handle->sync_count = 0;
+    if (msync(ring_buffer_handle->header, RING_BUFFER_FILE_HEADER_SIZE, MS_SYNC) != 0 || result != 0)
+        return RING_BUFFER_ERROR;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Sync, unmap and close the buffer, the file keeps the data for the next Ring_Buffer_File_Open
+ * \param[in] ring_buffer_handle: Buffer handle, it can not be used after close
+*/
+void Ring_Buffer_File_Close(ring_buffer_file *ring_buffer_handle)
+{
+    if (ring_buffer_handle->sync_policy != RING_BUFFER_FILE_SYNC_NONE)
+        Ring_Buffer_File_Sync(ring_buffer_handle);
+    else
+        Ring_Buffer_File_Commit(ring_buffer_handle, 0);
+    munmap(ring_buffer_handle->header, ring_buffer_handle->map_size);
+    close(ring_buffer_handle->fd);
+    ring_buffer_handle->header = NULL;
+    ring_buffer_handle->fd = -1;
+    ring_buffer_handle->ring.array_addr = NULL;
+}
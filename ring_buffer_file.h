@@ -0,0 +1,56 @@
+/**
+ * \file ring_buffer_file.h
+ * \brief File-backed persistent ring buffer correlation definition and statement (POSIX)
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.2.3
+*/
+
+#ifndef _RING_BUFFER_FILE_H_
+#define _RING_BUFFER_FILE_H_
+
+#include <stddef.h>
+#include "ring_buffer.h"
+
+#define RING_BUFFER_FILE_MAGIC          0x52424631 //"RBF1"
+#define RING_BUFFER_FILE_HEADER_SIZE    64         //Data starts after the header
+
+// msync policy, the mapping is shared so a process restart never loses data, msync only matters for power loss / kernel crash
+#define RING_BUFFER_FILE_SYNC_NONE      0x00 //Leave write back to the kernel
+#define RING_BUFFER_FILE_SYNC_ALWAYS    0x01 //msync after every operation
+#define RING_BUFFER_FILE_SYNC_INTERVAL  0x02 //msync every sync_interval operations
+
+// File header, lives at the beginning of the mapped file
+typedef struct
+{
+    uint32_t magic;      //RING_BUFFER_FILE_MAGIC
+    uint32_t version;    //Header layout version
+    uint32_t head;       //Saved head pointer
+    uint32_t tail;       //Saved tail pointer
+    uint32_t lenght;     //Saved data volume
+    uint32_t max_length; //Buffer maximum storage data amount
+} ring_buffer_file_header;
+
+// File-backed ring buffer handle
+typedef struct
+{
+    ring_buffer ring;                //Ring buffer working on the mapped data, can be used with all Ring_Buffer_xxx functions
+    ring_buffer_file_header *header; //Mapped file header
+    int fd;                          //Backing file descriptor
+    size_t map_size;                 //Mapping size
+    uint8_t sync_policy;             //RING_BUFFER_FILE_SYNC_xxx
+    uint32_t sync_interval;          //Operations between two msync for RING_BUFFER_FILE_SYNC_INTERVAL
+    uint32_t sync_count;             //Operations since the last msync
+    uint32_t commit_tail;            //Tail pointer at the last commit
+    uint32_t dirty_lenght;           //Bytes written before the tail pointer since the last msync, at most max_length
+} ring_buffer_file;
+
+uint8_t Ring_Buffer_File_Open(ring_buffer_file *ring_buffer_handle, const char *path, uint32_t buffer_size, uint8_t sync_policy, uint32_t sync_interval); //Create or re-attach a file-backed buffer
+uint8_t Ring_Buffer_File_Write_String(ring_buffer_file *ring_buffer_handle, void *input_addr, uint32_t write_lenght);                                     //Write the specified length data to the buffer
+uint8_t Ring_Buffer_File_Read_String(ring_buffer_file *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght);                                   //Read the specified length data from the buffer
+uint8_t Ring_Buffer_File_Delete(ring_buffer_file *ring_buffer_handle, uint32_t lenght);                                                                  //Delete data from the head pointer to the specified length
+void Ring_Buffer_File_Commit(ring_buffer_file *ring_buffer_handle, uint8_t data_changed);                                                                //Save the pointers to the file header after direct Ring_Buffer_xxx calls
+uint8_t Ring_Buffer_File_Sync(ring_buffer_file *ring_buffer_handle);                                                                                     //msync the data written since the last msync and the pointers now
+void Ring_Buffer_File_Close(ring_buffer_file *ring_buffer_handle);                                                                                       //Sync, unmap and close, the file keeps the data
+
+#endif
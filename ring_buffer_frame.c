@@ -0,0 +1,427 @@
+/**
+ * \file ring_buffer_frame.c
+ * \brief Ring buffer COBS / SLIP / HDLC frame codec implementation
+ * \details Frames are decoded straight from the stored data (Ring_Buffer_Get_Read_Spans) into the output,
+ * and encoded straight into the free space (Ring_Buffer_Get_Write_Spans), no byte-by-byte buffer call;
+ * The delimiter and escape bytes are found with RING_BUFFER_FIND_BYTE (memchr or a SIMD kernel),
+ * the bytes between them are moved with one memcpy per run; the encoder finds its runs with a 256-entry table;
+ * The delimiter scan resumes where the previous call stopped, and gives up after the longest encoding of a frame
+ * that fits the output, so noise without delimiters cannot fill the buffer;
+ * Empty frames (repeated delimiters) are skipped, so the SLIP / HDLC leading delimiter written by the encoder is harmless;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+*/
+
+#include "ring_buffer_frame.h"
+
+#define RING_BUFFER_FRAME_SLIP_END      0xC0
+#define RING_BUFFER_FRAME_SLIP_ESC      0xDB
+#define RING_BUFFER_FRAME_SLIP_ESC_END  0xDC
+#define RING_BUFFER_FRAME_SLIP_ESC_ESC  0xDD
+#define RING_BUFFER_FRAME_HDLC_FLAG     0x7E
+#define RING_BUFFER_FRAME_HDLC_ESC      0x7D
+#define RING_BUFFER_FRAME_HDLC_XOR      0x20
+
+// Bytes the encoder must stuff, one bit per framing (bit 0 COBS, bit 1 SLIP, bit 2 HDLC)
+static const uint8_t frame_special[256] = {
+    [0x00] = 1 << RING_BUFFER_FRAME_COBS,
+    [RING_BUFFER_FRAME_SLIP_END] = 1 << RING_BUFFER_FRAME_SLIP,
+    [RING_BUFFER_FRAME_SLIP_ESC] = 1 << RING_BUFFER_FRAME_SLIP,
+    [RING_BUFFER_FRAME_HDLC_FLAG] = 1 << RING_BUFFER_FRAME_HDLC,
+    [RING_BUFFER_FRAME_HDLC_ESC] = 1 << RING_BUFFER_FRAME_HDLC,
+};
+
+// Free space being filled by the encoder
+typedef struct
+{
+    ring_buffer_span span[2]; //From Ring_Buffer_Get_Write_Spans
+    uint8_t index;            //Span being filled
+    uint32_t pos;             //Bytes filled in that span
+    uint32_t written;         //Bytes filled in total, committed at the end of the frame
+} ring_buffer_frame_cursor;
+
+/**
+ * \brief Get the delimiter of a framing (private function)
+ * \param[in] type: RING_BUFFER_FRAME_xx
+ * \return Return the delimiter byte
+*/
+static uint8_t Ring_Buffer_Frame_Delimiter(uint8_t type)
+{
+    if (type == RING_BUFFER_FRAME_SLIP)
+        return RING_BUFFER_FRAME_SLIP_END;
+    if (type == RING_BUFFER_FRAME_HDLC)
+        return RING_BUFFER_FRAME_HDLC_FLAG;
+    return 0x00;
+}
+
+/**
+ * \brief Get the longest encoding of a frame (private function)
+ * \param[in] type: RING_BUFFER_FRAME_xx
+ * \param[in] lenght: Frame length before encoding
+ * \return Return the encoded length without delimiters
+*/
+static uint32_t Ring_Buffer_Frame_Max_Encoded(uint8_t type, uint32_t lenght)
+{
+    if (type == RING_BUFFER_FRAME_COBS)
+        return lenght + lenght / 254 + 1; //One code byte per 254 bytes
+    return lenght * 2;                    //Every byte escaped
+}
+
+/**
+ * \brief Copy data into the free space (private function)
+ * \param[out] cursor: Free space being filled
+ * \param[in] input_addr: Data to copy
+ * \param[in] lenght: Number of bytes
+ * \return Return the result of the copy
+ *      \arg RING_BUFFER_SUCCESS: Copied
+ *      \arg RING_BUFFER_ERROR: Not enough free space
+*/
+static uint8_t Ring_Buffer_Frame_Put(ring_buffer_frame_cursor *cursor, const uint8_t *input_addr, uint32_t lenght)
+{
+    uint32_t size;
+    while (lenght != 0)
+    {
+        size = cursor->span[cursor->index].lenght - cursor->pos;
+        if (size == 0) //This span is full, continue at the beginning of the array
+        {
+            if (cursor->index == 1)
+                return RING_BUFFER_ERROR;
+            cursor->index = 1;
+            cursor->pos = 0;
+            continue;
+        }
+        if (size > lenght)
+            size = lenght;
+        memcpy(cursor->span[cursor->index].addr + cursor->pos, input_addr, size);
+        cursor->pos += size;
+        cursor->written += size;
+        input_addr += size;
+        lenght -= size;
+    }
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Reserve one byte of free space, filled in later (private function)
+ * \param[out] cursor: Free space being filled
+ * \return Return the address of the byte, NULL: Not enough free space
+*/
+static uint8_t *Ring_Buffer_Frame_Reserve(ring_buffer_frame_cursor *cursor)
+{
+    uint8_t *addr;
+    if (cursor->pos == cursor->span[cursor->index].lenght)
+    {
+        if (cursor->index == 1 || cursor->span[1].lenght == 0)
+            return NULL;
+        cursor->index = 1;
+        cursor->pos = 0;
+    }
+    addr = cursor->span[cursor->index].addr + cursor->pos;
+    cursor->pos++;
+    cursor->written++;
+    return addr;
+}
+
+/**
+ * \brief COBS encode into the free space (private function)
+ * \param[out] cursor: Free space being filled
+ * \param[in] input_addr: Frame to encode
+ * \param[in] input_lenght: Frame length
+ * \return Return RING_BUFFER_SUCCESS / RING_BUFFER_ERROR: Not enough free space
+*/
+static uint8_t Ring_Buffer_Frame_Encode_COBS(ring_buffer_frame_cursor *cursor, const uint8_t *input_addr, uint32_t input_lenght)
+{
+    const uint8_t *found;
+    uint8_t *code_addr;
+    uint32_t run;
+    for (;;)
+    {
+        //A block is a code byte and up to 254 non-zero bytes, the code is the distance to the next zero
+        run = input_lenght < 254 ? input_lenght : 254;
+        found = RING_BUFFER_FIND_BYTE(input_addr, 0x00, run);
+        if (found != NULL)
+            run = (uint32_t)(found - input_addr);
+        code_addr = Ring_Buffer_Frame_Reserve(cursor);
+        if (code_addr == NULL || Ring_Buffer_Frame_Put(cursor, input_addr, run) != RING_BUFFER_SUCCESS)
+            return RING_BUFFER_ERROR;
+        input_addr += run;
+        input_lenght -= run;
+        if (run == 254) //Full block, no zero follows it
+        {
+            *code_addr = 0xFF;
+            if (input_lenght == 0)
+                break;
+            continue;
+        }
+        *code_addr = (uint8_t)(run + 1);
+        if (input_lenght == 0)
+            break;
+        input_addr++; //Skip the zero, it is implied by the code
+        input_lenght--;
+    }
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief SLIP / HDLC encode into the free space (private function)
+ * \param[out] cursor: Free space being filled
+ * \param[in] type: RING_BUFFER_FRAME_SLIP / RING_BUFFER_FRAME_HDLC
+ * \param[in] input_addr: Frame to encode
+ * \param[in] input_lenght: Frame length
+ * \return Return RING_BUFFER_SUCCESS / RING_BUFFER_ERROR: Not enough free space
+*/
+static uint8_t Ring_Buffer_Frame_Encode_Escaped(ring_buffer_frame_cursor *cursor, uint8_t type, const uint8_t *input_addr, uint32_t input_lenght)
+{
+    uint8_t mask = 1 << type, escape[2];
+    uint32_t run;
+    while (input_lenght != 0)
+    {
+        for (run = 0; run < input_lenght && !(frame_special[input_addr[run]] & mask); run++)
+            ; //Bytes sent as they are
+        if (Ring_Buffer_Frame_Put(cursor, input_addr, run) != RING_BUFFER_SUCCESS)
+            return RING_BUFFER_ERROR;
+        input_addr += run;
+        input_lenght -= run;
+        if (input_lenght == 0)
+            break;
+        if (type == RING_BUFFER_FRAME_SLIP)
+        {
+            escape[0] = RING_BUFFER_FRAME_SLIP_ESC;
+            escape[1] = *input_addr == RING_BUFFER_FRAME_SLIP_END ? RING_BUFFER_FRAME_SLIP_ESC_END : RING_BUFFER_FRAME_SLIP_ESC_ESC;
+        }
+        else
+        {
+            escape[0] = RING_BUFFER_FRAME_HDLC_ESC;
+            escape[1] = *input_addr ^ RING_BUFFER_FRAME_HDLC_XOR;
+        }
+        if (Ring_Buffer_Frame_Put(cursor, escape, 2) != RING_BUFFER_SUCCESS)
+            return RING_BUFFER_ERROR;
+        input_addr++;
+        input_lenght--;
+    }
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief COBS decode a frame without its delimiter (private function)
+ * \param[in] span: Encoded frame, at most two spans
+ * \param[out] output_addr: Decoded frame
+ * \param[in] output_size: Output space
+ * \param[out] output_lenght: Decoded length
+ * \return Return RING_BUFFER_SUCCESS / RING_BUFFER_ERROR: Malformed or longer than output_size
+*/
+static uint8_t Ring_Buffer_Frame_Decode_COBS(const ring_buffer_span *span, uint8_t *output_addr, uint32_t output_size, uint32_t *output_lenght)
+{
+    uint32_t left = 0, out = 0, pos, size;
+    uint8_t code = 0xFF, i; //No zero before the first block
+    for (i = 0; i < 2; i++)
+    {
+        for (pos = 0; pos < span[i].lenght;)
+        {
+            if (left == 0) //Code byte, a zero ends the previous block unless it was full
+            {
+                if (code != 0xFF)
+                {
+                    if (out == output_size)
+                        return RING_BUFFER_ERROR;
+                    output_addr[out++] = 0x00;
+                }
+                code = span[i].addr[pos++];
+                left = code - 1;
+                continue;
+            }
+            size = span[i].lenght - pos; //Copy the block, or the part of it in this span
+            if (size > left)
+                size = left;
+            if (size > output_size - out)
+                return RING_BUFFER_ERROR;
+            memcpy(output_addr + out, span[i].addr + pos, size);
+            out += size;
+            pos += size;
+            left -= size;
+        }
+    }
+    *output_lenght = out;
+    return left == 0 ? RING_BUFFER_SUCCESS : RING_BUFFER_ERROR; //A block cut short by the delimiter
+}
+
+/**
+ * \brief SLIP / HDLC decode a frame without its delimiters (private function)
+ * \param[in] span: Encoded frame, at most two spans
+ * \param[in] type: RING_BUFFER_FRAME_SLIP / RING_BUFFER_FRAME_HDLC
+ * \param[out] output_addr: Decoded frame
+ * \param[in] output_size: Output space
+ * \param[out] output_lenght: Decoded length
+ * \return Return RING_BUFFER_SUCCESS / RING_BUFFER_ERROR: Malformed or longer than output_size
+*/
+static uint8_t Ring_Buffer_Frame_Decode_Escaped(const ring_buffer_span *span, uint8_t type, uint8_t *output_addr, uint32_t output_size, uint32_t *output_lenght)
+{
+    uint8_t escape = type == RING_BUFFER_FRAME_SLIP ? RING_BUFFER_FRAME_SLIP_ESC : RING_BUFFER_FRAME_HDLC_ESC;
+    uint8_t escaped = 0, rb_data, i;
+    uint32_t out = 0, pos, size;
+    const uint8_t *found;
+    for (i = 0; i < 2; i++)
+    {
+        for (pos = 0; pos < span[i].lenght;)
+        {
+            if (escaped) //Byte after the escape, may be in the next span
+            {
+                rb_data = span[i].addr[pos++];
+                if (type == RING_BUFFER_FRAME_HDLC)
+                    rb_data ^= RING_BUFFER_FRAME_HDLC_XOR;
+                else if (rb_data == RING_BUFFER_FRAME_SLIP_ESC_END)
+                    rb_data = RING_BUFFER_FRAME_SLIP_END;
+                else if (rb_data == RING_BUFFER_FRAME_SLIP_ESC_ESC)
+                    rb_data = RING_BUFFER_FRAME_SLIP_ESC;
+                else
+                    return RING_BUFFER_ERROR; //Protocol violation
+                if (out == output_size)
+                    return RING_BUFFER_ERROR;
+                output_addr[out++] = rb_data;
+                escaped = 0;
+                continue;
+            }
+            //Copy up to the next escape byte
+            found = RING_BUFFER_FIND_BYTE(span[i].addr + pos, escape, span[i].lenght - pos);
+            size = found != NULL ? (uint32_t)(found - (span[i].addr + pos)) : span[i].lenght - pos;
+            if (size > output_size - out)
+                return RING_BUFFER_ERROR;
+            memcpy(output_addr + out, span[i].addr + pos, size);
+            out += size;
+            pos += size;
+            if (found != NULL)
+            {
+                escaped = 1;
+                pos++;
+            }
+        }
+    }
+    *output_lenght = out;
+    return escaped ? RING_BUFFER_ERROR : RING_BUFFER_SUCCESS; //An escape right before the delimiter
+}
+
+/**
+ * \brief Attach a frame codec to a buffer
+ * \param[out] frame: Frame codec state
+ * \param[in] ring_buffer_handle: Buffer structure the frames are read from / written to
+ * \param[in] type: RING_BUFFER_FRAME_COBS / RING_BUFFER_FRAME_SLIP / RING_BUFFER_FRAME_HDLC
+*/
+void Ring_Buffer_Frame_Init(ring_buffer_frame *frame, ring_buffer *ring_buffer_handle, uint8_t type)
+{
+    frame->ring_buffer_handle = ring_buffer_handle;
+    frame->type = type;
+    frame->discard = 0;
+    frame->scanned = 0;
+}
+
+/**
+ * \brief Encode a frame into the buffer, with its delimiter(s)
+ * \details The frame is encoded in the free space and committed at once, a failed write leaves the buffer unchanged;
+ * An empty SLIP / HDLC frame is only two delimiters, the reader skips it
+ * \param[in] frame: Frame codec state
+ * \param[in] input_addr: Frame to encode
+ * \param[in] input_lenght: Frame length
+ * \return Return the result of the write
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure, not enough free space for the encoded frame
+*/
+uint8_t Ring_Buffer_Frame_Write(ring_buffer_frame *frame, const void *input_addr, uint32_t input_lenght)
+{
+    ring_buffer_frame_cursor cursor;
+    uint8_t delimiter = Ring_Buffer_Frame_Delimiter(frame->type), result;
+    Ring_Buffer_Get_Write_Spans(frame->ring_buffer_handle, cursor.span);
+    cursor.index = 0;
+    cursor.pos = 0;
+    cursor.written = 0;
+    if (frame->type == RING_BUFFER_FRAME_COBS)
+        result = Ring_Buffer_Frame_Encode_COBS(&cursor, (const uint8_t *)input_addr, input_lenght);
+    else //Opening delimiter, ends any noise received before the frame
+        result = Ring_Buffer_Frame_Put(&cursor, &delimiter, 1) == RING_BUFFER_SUCCESS ? Ring_Buffer_Frame_Encode_Escaped(&cursor, frame->type, (const uint8_t *)input_addr, input_lenght) : RING_BUFFER_ERROR;
+    if (result != RING_BUFFER_SUCCESS || Ring_Buffer_Frame_Put(&cursor, &delimiter, 1) != RING_BUFFER_SUCCESS)
+    {
+        RING_BUFFER_STATS_REJECT(frame->ring_buffer_handle);
+        return RING_BUFFER_ERROR;
+    }
+    return Ring_Buffer_Commit_Write(frame->ring_buffer_handle, cursor.written);
+}
+
+/**
+ * \brief Decode the next frame from the buffer, the frame and its delimiter are removed
+ * \param[in] frame: Frame codec state
+ * \param[out] output_addr: Decoded frame
+ * \param[in] output_size: Output space, longer frames are dropped
+ * \param[out] output_lenght: Decoded length, 0 unless RING_BUFFER_FRAME_READY
+ * \return Return the result of the decode
+ *      \arg RING_BUFFER_FRAME_NONE: No complete frame yet, call again when more data has been written
+ *      \arg RING_BUFFER_FRAME_READY: A frame was decoded into the output
+ *      \arg RING_BUFFER_FRAME_DROPPED: A malformed or too long frame was removed
+*/
+uint8_t Ring_Buffer_Frame_Read(ring_buffer_frame *frame, uint8_t *output_addr, uint32_t output_size, uint32_t *output_lenght)
+{
+    ring_buffer_span data[2], encoded[2];
+    uint8_t delimiter = Ring_Buffer_Frame_Delimiter(frame->type), result, i;
+    uint32_t lenght, limit, offset, size, frame_lenght;
+    const uint8_t *found;
+    *output_lenght = 0;
+    for (;;)
+    {
+        lenght = Ring_Buffer_Get_Read_Spans(frame->ring_buffer_handle, data);
+        //Longest encoded frame that can fit the output, the delimiter must show up within it
+        limit = Ring_Buffer_Frame_Max_Encoded(frame->type, output_size) + 1;
+        if (limit > lenght || limit < output_size) //Also when the multiplication wrapped around
+            limit = lenght;
+        found = NULL;
+        while (found == NULL && frame->scanned < limit)
+        {
+            i = frame->scanned < data[0].lenght ? 0 : 1;
+            offset = i ? frame->scanned - data[0].lenght : frame->scanned;
+            size = data[i].lenght - offset;
+            if (size > limit - frame->scanned)
+                size = limit - frame->scanned;
+            found = RING_BUFFER_FIND_BYTE(data[i].addr + offset, delimiter, size);
+            if (found == NULL)
+                frame->scanned += size;
+            else
+                frame->scanned += (uint32_t)(found - (data[i].addr + offset));
+        }
+        if (found == NULL)
+        {
+            //Too long for the output, or the buffer is full of noise: drop what was scanned, the rest of the frame goes later
+            if (frame->scanned != 0 && (frame->scanned < lenght || lenght == RING_BUFFER_CAPACITY(frame->ring_buffer_handle)))
+            {
+                Ring_Buffer_Delete(frame->ring_buffer_handle, frame->scanned);
+                frame->scanned = 0;
+                frame->discard = 1;
+                return RING_BUFFER_FRAME_DROPPED;
+            }
+            return RING_BUFFER_FRAME_NONE;
+        }
+        frame_lenght = frame->scanned; //Encoded frame without the delimiter
+        frame->scanned = 0;
+        if (frame->discard || frame_lenght == 0) //Rest of a frame already reported as dropped / repeated delimiter
+        {
+            Ring_Buffer_Delete(frame->ring_buffer_handle, frame_lenght + 1);
+            frame->discard = 0;
+            continue;
+        }
+        break;
+    }
+    encoded[0].addr = data[0].addr;
+    encoded[0].lenght = frame_lenght < data[0].lenght ? frame_lenght : data[0].lenght;
+    encoded[1].addr = data[1].addr;
+    encoded[1].lenght = frame_lenght - encoded[0].lenght;
+    if (frame->type == RING_BUFFER_FRAME_COBS)
+        result = Ring_Buffer_Frame_Decode_COBS(encoded, output_addr, output_size, output_lenght);
+    else
+        result = Ring_Buffer_Frame_Decode_Escaped(encoded, frame->type, output_addr, output_size, output_lenght);
+    Ring_Buffer_Delete(frame->ring_buffer_handle, frame_lenght + 1);
+    if (result != RING_BUFFER_SUCCESS)
+    {
+        *output_lenght = 0;
+        return RING_BUFFER_FRAME_DROPPED;
+    }
+    return RING_BUFFER_FRAME_READY;
+}
@@ -0,0 +1,37 @@
+/**
+ * \file ring_buffer_frame.h
+ * \brief Ring buffer COBS / SLIP / HDLC frame codec correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_FRAME_H_
+#define _RING_BUFFER_FRAME_H_
+
+#include "ring_buffer.h"
+
+// Framing
+#define RING_BUFFER_FRAME_COBS      0x00 //Consistent Overhead Byte Stuffing, each frame ends with 0x00
+#define RING_BUFFER_FRAME_SLIP      0x01 //SLIP (RFC 1055), END 0xC0, ESC 0xDB
+#define RING_BUFFER_FRAME_HDLC      0x02 //Asynchronous HDLC byte stuffing (RFC 1662), flag 0x7E, escape 0x7D, no control character map, no FCS
+
+// Ring_Buffer_Frame_Read result
+#define RING_BUFFER_FRAME_NONE      0x00 //No complete frame yet
+#define RING_BUFFER_FRAME_READY     0x01 //A frame was decoded into the output
+#define RING_BUFFER_FRAME_DROPPED   0x02 //A malformed or too long frame was removed, call again for the next one
+
+// Frame codec state, one per buffer
+typedef struct
+{
+    ring_buffer *ring_buffer_handle; //Buffer the frames are read from / written to
+    uint8_t type;                    //RING_BUFFER_FRAME_xx
+    uint8_t discard;                 //The start of an over-long frame was dropped, drop the rest up to its delimiter
+    uint32_t scanned;                //Bytes from the head pointer already checked for the delimiter
+} ring_buffer_frame;
+
+void Ring_Buffer_Frame_Init(ring_buffer_frame *frame, ring_buffer *ring_buffer_handle, uint8_t type);                              //Attach a frame codec to a buffer
+uint8_t Ring_Buffer_Frame_Write(ring_buffer_frame *frame, const void *input_addr, uint32_t input_lenght);                        //Encode a frame into the buffer
+uint8_t Ring_Buffer_Frame_Read(ring_buffer_frame *frame, uint8_t *output_addr, uint32_t output_size, uint32_t *output_lenght); //Decode the next frame from the buffer
+
+#endif
@@ -0,0 +1,142 @@
+/**
+ * \file ring_buffer_large.c
+ * \brief Large ring buffer with size_t pointers implementation
+ * \details Same functions as the byte ring buffer, pointers and lengths are size_t so a 64-bit build can hold rings
+ * of tens of GB (e.g. packet capture storage from Ring_Buffer_Alloc_Storage);
+ * Small buffers should keep using ring_buffer, its 32-bit pointers keep the structure and the arithmetic smaller;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.1.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+ * 2026.10.16 v1.1.0 String copies go through RING_BUFFER_COPY_IN / OUT (non-temporal large transfers)
+*/
+
+#include "ring_buffer_large.h"
+
+/**
+ * \brief Initialization new buffer
+ * \param[out] ring_buffer_handle: Buffer structure handle to be initialized
+ * \param[in] buffer_addr: Array of external definitions
+ * \param[in] buffer_size: External defined buffer array space
+ * \return Returns the result of the buffer initialization
+ *      \arg RING_BUFFER_SUCCESS: Initialization successful
+ *      \arg RING_BUFFER_ERROR: initialization failed
+*/
+uint8_t Ring_Buffer_Large_Init(ring_buffer_large *ring_buffer_handle, uint8_t *buffer_addr, size_t buffer_size)
+{
+    ring_buffer_handle->head = 0;                 //Reset head pointer
+    ring_buffer_handle->tail = 0;                 //Reset tail pointer
+    ring_buffer_handle->lenght = 0;               //Reset has stored data length
+    ring_buffer_handle->array_addr = buffer_addr; //Buffer storage number base address
+    ring_buffer_handle->max_length = buffer_size; //Buffer maximum storage data amount
+    if (buffer_size < 2)                          //Buffer arrays must have two elements or more
+        return RING_BUFFER_ERROR;
+    else
+        return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Write the data of the specified length to the tail of the buffer
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] input_addr: Base site to be written to
+ * \param[in] write_lenght: Number of bytes to be written
+ * \return Returns the result of the end of the buffer to write the specified length byte
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure, nothing is written
+*/
+uint8_t Ring_Buffer_Large_Write_String(ring_buffer_large *ring_buffer_handle, const void *input_addr, size_t write_lenght)
+{
+    size_t write_size_a;
+    if (write_lenght > ring_buffer_handle->max_length - ring_buffer_handle->lenght)
+        return RING_BUFFER_ERROR; //Not enough space to store new data
+    //From the tail pointer to the end of the array, the rest is written from the beginning
+    write_size_a = ring_buffer_handle->max_length - ring_buffer_handle->tail;
+    if (write_size_a >= write_lenght)
+    {
+        RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr + ring_buffer_handle->tail, input_addr, write_lenght);
+        ring_buffer_handle->tail += write_lenght;
+        if (ring_buffer_handle->tail == ring_buffer_handle->max_length)
+            ring_buffer_handle->tail = 0;
+    }
+    else //Need to write twice
+    {
+        RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr + ring_buffer_handle->tail, input_addr, write_size_a);
+        RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr, (const uint8_t *)input_addr + write_size_a, write_lenght - write_size_a);
+        ring_buffer_handle->tail = write_lenght - write_size_a;
+    }
+    ring_buffer_handle->lenght += write_lenght; //How much data is recorded
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Read the data of the specified length to the buffer header, save to the specified address
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] output_addr: Read data saved address
+ * \param[in] read_lenght: Number of bytes to read
+ * \return Returns the result of the buffer header read the specified length byte
+ *      \arg RING_BUFFER_SUCCESS: Read success
+ *      \arg RING_BUFFER_ERROR: Read failure, nothing is read
+*/
+uint8_t Ring_Buffer_Large_Read_String(ring_buffer_large *ring_buffer_handle, uint8_t *output_addr, size_t read_lenght)
+{
+    size_t read_size_a;
+    if (read_lenght > ring_buffer_handle->lenght)
+        return RING_BUFFER_ERROR;
+    read_size_a = ring_buffer_handle->max_length - ring_buffer_handle->head;
+    if (read_size_a >= read_lenght)
+    {
+        RING_BUFFER_COPY_OUT(output_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head, read_lenght);
+        ring_buffer_handle->head += read_lenght;
+        if (ring_buffer_handle->head == ring_buffer_handle->max_length)
+            ring_buffer_handle->head = 0;
+    }
+    else //Need to read twice
+    {
+        RING_BUFFER_COPY_OUT(output_addr, ring_buffer_handle->array_addr + ring_buffer_handle->head, read_size_a);
+        RING_BUFFER_COPY_OUT(output_addr + read_size_a, ring_buffer_handle->array_addr, read_lenght - read_size_a);
+        ring_buffer_handle->head = read_lenght - read_size_a;
+    }
+    ring_buffer_handle->lenght -= read_lenght; //Record the amount of remaining data
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Delete data from the head pointer to the specified length, the head pointer just moves, nothing is copied
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] lenght: To delete the length
+ * \return Return to delete the specified length data result
+ *      \arg RING_BUFFER_SUCCESS: successfully deleted
+ *      \arg RING_BUFFER_ERROR: failed to delete
+*/
+uint8_t Ring_Buffer_Large_Delete(ring_buffer_large *ring_buffer_handle, size_t lenght)
+{
+    if (ring_buffer_handle->lenght < lenght)
+        return RING_BUFFER_ERROR; //The amount of data that has been stored is less than the amount of data that needs to be deleted
+    if (lenght >= ring_buffer_handle->max_length - ring_buffer_handle->head)
+        ring_buffer_handle->head = lenght - (ring_buffer_handle->max_length - ring_buffer_handle->head);
+    else
+        ring_buffer_handle->head += lenght; //Head pointer advances forward, abandon data
+    ring_buffer_handle->lenght -= lenght;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Get the data length that has been stored in the buffer
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \return Returns the amount of data already stored in the buffer
+*/
+size_t Ring_Buffer_Large_Get_Length(ring_buffer_large *ring_buffer_handle)
+{
+    return ring_buffer_handle->lenght;
+}
+
+/**
+ * \brief Get a buffer available storage space
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \return Return to buffer available storage space
+*/
+size_t Ring_Buffer_Large_Get_FreeSize(ring_buffer_large *ring_buffer_handle)
+{
+    return (ring_buffer_handle->max_length - ring_buffer_handle->lenght);
+}
@@ -0,0 +1,32 @@
+/**
+ * \file ring_buffer_large.h
+ * \brief Large ring buffer with size_t pointers correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_LARGE_H_
+#define _RING_BUFFER_LARGE_H_
+
+#include <stddef.h>
+#include "ring_buffer.h"
+
+// Large ring buffer structure, same layout as ring_buffer with size_t pointers and lengths
+typedef struct
+{
+    size_t head;         //Operating head pointer
+    size_t tail;         //Operate tail pointer
+    size_t lenght;       //Saved data volume
+    uint8_t *array_addr; //Buffer storage number base address
+    size_t max_length;   //Buffer maximum storage data amount
+} ring_buffer_large;
+
+uint8_t Ring_Buffer_Large_Init(ring_buffer_large *ring_buffer_handle, uint8_t *buffer_addr, size_t buffer_size);             //Initialization new buffer
+uint8_t Ring_Buffer_Large_Write_String(ring_buffer_large *ring_buffer_handle, const void *input_addr, size_t write_lenght); //Write the specified length data to the buffer
+uint8_t Ring_Buffer_Large_Read_String(ring_buffer_large *ring_buffer_handle, uint8_t *output_addr, size_t read_lenght);     //Read the specified length data from the buffer
+uint8_t Ring_Buffer_Large_Delete(ring_buffer_large *ring_buffer_handle, size_t lenght);                                     //Delete data from the head pointer to the specified length
+size_t Ring_Buffer_Large_Get_Length(ring_buffer_large *ring_buffer_handle);                                                 //Get the data length that has been stored in the buffer
+size_t Ring_Buffer_Large_Get_FreeSize(ring_buffer_large *ring_buffer_handle);                                               //Get a buffer available storage space
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * \file ring_buffer_line.c
+ * \brief Ring buffer line reader implementation
+ * \details Reads newline-terminated text (e.g. AT commands, NMEA) from a ring buffer without copying it;
+ * A line is returned as one or two spans inside the buffer array, and stays there until Ring_Buffer_Line_Release;
+ * The reader remembers how far it has scanned, a partial line is not scanned again when more data arrives;
+ * The scan stops after max_line bytes, an over-long line is returned in pieces instead of blocking the buffer;
+ * The buffer must only be read through the line reader while it is attached, writing is not restricted;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+*/
+
+#include "ring_buffer_line.h"
+
+/**
+ * \brief Get a byte at an offset into two spans (private function)
+ * \param[in] data: Spans from Ring_Buffer_Get_Read_Spans
+ * \param[in] offset: Offset from the head pointer, must be inside the data
+ * \return Return the byte
+*/
+static uint8_t Ring_Buffer_Line_Byte(const ring_buffer_span *data, uint32_t offset)
+{
+    if (offset < data[0].lenght)
+        return data[0].addr[offset];
+    return data[1].addr[offset - data[0].lenght];
+}
+
+/**
+ * \brief Attach a line reader to a buffer
+ * \param[out] line: Line reader state
+ * \param[in] ring_buffer_handle: Buffer structure the lines are read from
+ * \param[in] max_line: Longest line including "\r\n", 0 or more than the buffer capacity: the buffer capacity
+*/
+void Ring_Buffer_Line_Init(ring_buffer_line *line, ring_buffer *ring_buffer_handle, uint32_t max_line)
+{
+    //A line longer than the buffer could never complete, the writer would wait for space forever
+    if (max_line == 0 || max_line > RING_BUFFER_CAPACITY(ring_buffer_handle))
+        max_line = RING_BUFFER_CAPACITY(ring_buffer_handle);
+    line->ring_buffer_handle = ring_buffer_handle;
+    line->max_line = max_line;
+    line->scanned = 0;
+    line->consume = 0;
+}
+
+/**
+ * \brief Get the next line in place, the line is not removed from the buffer
+ * \details Returns the same line again until Ring_Buffer_Line_Release is called
+ * \param[in] line: Line reader state
+ * \param[out] span: Two spans holding the line without its "\n" / "\r\n", span[1].lenght is 0 unless the line wraps
+ * \return Return the result of the search
+ *      \arg RING_BUFFER_LINE_NONE: No complete line yet, call again when more data has been written
+ *      \arg RING_BUFFER_LINE_READY: A complete line is in span
+ *      \arg RING_BUFFER_LINE_TOO_LONG: No "\n" within max_line bytes, span holds the first max_line bytes
+*/
+uint8_t Ring_Buffer_Line_Get(ring_buffer_line *line, ring_buffer_span *span)
+{
+    ring_buffer_span data[2];
+    uint32_t lenght = Ring_Buffer_Get_Read_Spans(line->ring_buffer_handle, data);
+    uint32_t limit = lenght < line->max_line ? lenght : line->max_line; //Bytes the scan may reach
+    uint32_t line_lenght, offset, size;
+    const uint8_t *found = NULL;
+    uint8_t result = RING_BUFFER_LINE_READY, i;
+    while (found == NULL && line->scanned < limit)
+    {
+        //Scan the rest of the span holding the first unchecked byte
+        i = line->scanned < data[0].lenght ? 0 : 1;
+        offset = i ? line->scanned - data[0].lenght : line->scanned;
+        size = data[i].lenght - offset;
+        if (size > limit - line->scanned)
+            size = limit - line->scanned;
+        found = RING_BUFFER_FIND_BYTE(data[i].addr + offset, '\n', size);
+        if (found != NULL)
+            line->consume = line->scanned + (uint32_t)(found - (data[i].addr + offset)) + 1;
+        else
+            line->scanned += size;
+    }
+    if (found != NULL)
+    {
+        line_lenght = line->consume - 1; //Without "\n"
+        if (line_lenght != 0 && Ring_Buffer_Line_Byte(data, line_lenght - 1) == '\r')
+            line_lenght--; //Without "\r\n"
+    }
+    else if (line->scanned >= line->max_line)
+    {
+        line->consume = line->max_line; //The line goes on past the limit, hand out this piece
+        line_lenght = line->max_line;
+        result = RING_BUFFER_LINE_TOO_LONG;
+    }
+    else
+        return RING_BUFFER_LINE_NONE; //Wait for the rest of the line, the scanned part is not checked again
+    span[0].addr = data[0].addr;
+    span[0].lenght = line_lenght < data[0].lenght ? line_lenght : data[0].lenght;
+    span[1].addr = data[1].addr;
+    span[1].lenght = line_lenght - span[0].lenght;
+    return result;
+}
+
+/**
+ * \brief Remove the line returned by Ring_Buffer_Line_Get, its spans are no longer valid
+ * \param[in] line: Line reader state
+ * \return Return the result of the removal
+ *      \arg RING_BUFFER_SUCCESS: Line removed
+ *      \arg RING_BUFFER_ERROR: No line was returned since the last release
+*/
+uint8_t Ring_Buffer_Line_Release(ring_buffer_line *line)
+{
+    uint32_t consume = line->consume;
+    if (consume == 0)
+        return RING_BUFFER_ERROR;
+    line->scanned = 0; //The next line starts at the new head pointer
+    line->consume = 0;
+    return Ring_Buffer_Delete(line->ring_buffer_handle, consume);
+}
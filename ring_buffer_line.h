@@ -0,0 +1,32 @@
+/**
+ * \file ring_buffer_line.h
+ * \brief Ring buffer line reader correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_LINE_H_
+#define _RING_BUFFER_LINE_H_
+
+#include "ring_buffer.h"
+
+// Ring_Buffer_Line_Get result
+#define RING_BUFFER_LINE_NONE       0x00 //No complete line yet
+#define RING_BUFFER_LINE_READY      0x01 //A complete line, without its "\n" / "\r\n"
+#define RING_BUFFER_LINE_TOO_LONG   0x02 //No "\n" within max_line bytes, the first max_line bytes are returned, the rest follows as the next line
+
+// Line reader state, one per buffer
+typedef struct
+{
+    ring_buffer *ring_buffer_handle; //Buffer the lines are read from
+    uint32_t max_line;               //Longest line including its terminator, the scan never goes further
+    uint32_t scanned;                //Bytes from the head pointer already checked, not scanned again on the next call
+    uint32_t consume;                //Bytes of the returned line including its terminator, removed by Ring_Buffer_Line_Release
+} ring_buffer_line;
+
+void Ring_Buffer_Line_Init(ring_buffer_line *line, ring_buffer *ring_buffer_handle, uint32_t max_line); //Attach a line reader to a buffer
+uint8_t Ring_Buffer_Line_Get(ring_buffer_line *line, ring_buffer_span *span);                          //Get the next line in place as two spans
+uint8_t Ring_Buffer_Line_Release(ring_buffer_line *line);                                              //Remove the line returned by Ring_Buffer_Line_Get
+
+#endif
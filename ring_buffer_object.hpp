@@ -0,0 +1,124 @@
+/**
+ * \file ring_buffer_object.hpp
+ * \brief C++ ring buffer of objects, elements are constructed in place in raw aligned storage
+ * \details Suitable for queueing non-trivial objects (std::string, std::unique_ptr, ...) between stages without serializing them into the byte ring;
+ * The storage is a member array of the ring, the ring itself never allocates on the heap;
+ * Elements are moved out on pop and destroyed on clear / destruction;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+*/
+
+#ifndef _RING_BUFFER_OBJECT_HPP_
+#define _RING_BUFFER_OBJECT_HPP_
+
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename T, uint32_t N>
+class ring_buffer_object
+{
+    static_assert(N >= 1, "ring_buffer_object needs at least one element");
+
+public:
+    ring_buffer_object() : head(0), tail(0), lenght(0) {}
+    ~ring_buffer_object() { clear(); }
+
+    ring_buffer_object(const ring_buffer_object &) = delete;
+    ring_buffer_object &operator=(const ring_buffer_object &) = delete;
+
+    /**
+     * \brief Construct a new element in place at the end of the buffer
+     * \param[in] args: Arguments forwarded to the constructor of T
+     * \return Returns true on success, false if the buffer is full (nothing is constructed)
+    */
+    template <typename... Args>
+    bool emplace_back(Args &&...args)
+    {
+        if (lenght == N)
+            return false;
+        ::new (static_cast<void *>(storage[tail])) T(std::forward<Args>(args)...);
+        tail = (tail + 1 == N) ? 0 : tail + 1; //Tail pointer reaches the end of the array, return to the beginning
+        lenght++;
+        return true;
+    }
+
+    /**
+     * \brief Copy or move an element to the end of the buffer
+     * \param[in] value: Element to be stored
+     * \return Returns true on success, false if the buffer is full
+    */
+    bool push_back(const T &value) { return emplace_back(value); }
+    bool push_back(T &&value) { return emplace_back(std::move(value)); }
+
+    /**
+     * \brief Move the element at the head pointer out of the buffer and destroy the slot
+     * \param[out] value: Receives the element by move assignment
+     * \return Returns true on success, false if the buffer is empty
+    */
+    bool pop_front(T &value)
+    {
+        if (lenght == 0)
+            return false;
+        T *element = slot(head);
+        value = std::move(*element);
+        element->~T();
+        head = (head + 1 == N) ? 0 : head + 1;
+        lenght--;
+        return true;
+    }
+
+    /**
+     * \brief Destroy the element at the head pointer without reading it
+     * \return Returns true on success, false if the buffer is empty
+    */
+    bool pop_front()
+    {
+        if (lenght == 0)
+            return false;
+        slot(head)->~T();
+        head = (head + 1 == N) ? 0 : head + 1;
+        lenght--;
+        return true;
+    }
+
+    /**
+     * \brief Access the element at the head pointer, the buffer must not be empty
+    */
+    T &front() { return *slot(head); }
+    const T &front() const { return *slot(head); }
+
+    /**
+     * \brief Destroy all stored elements and reset the pointers
+    */
+    void clear()
+    {
+        if (!std::is_trivially_destructible<T>::value)
+            while (lenght != 0)
+                pop_front();
+        head = 0;
+        tail = 0;
+        lenght = 0;
+    }
+
+    uint32_t size() const { return lenght; }           //Number of stored elements
+    uint32_t free_size() const { return N - lenght; }  //Number of elements that can still be stored
+    static constexpr uint32_t capacity() { return N; } //Maximum number of elements
+    bool empty() const { return lenght == 0; }
+    bool full() const { return lenght == N; }
+
+private:
+    T *slot(uint32_t index) { return std::launder(reinterpret_cast<T *>(storage[index])); }
+    const T *slot(uint32_t index) const { return std::launder(reinterpret_cast<const T *>(storage[index])); }
+
+    alignas(T) unsigned char storage[N][sizeof(T)]; //Raw storage, elements are only alive between head and tail
+    uint32_t head;                                  //Operating head pointer
+    uint32_t tail;                                  //Operate tail pointer
+    uint32_t lenght;                                //Saved element count
+};
+
+#endif
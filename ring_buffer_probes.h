@@ -0,0 +1,34 @@
+/**
+ * \file ring_buffer_probes.h
+ * \brief Ring buffer USDT probe definition (Linux)
+ * \details Probes are placed with <sys/sdt.h> (systemtap-sdt-dev), each one is a single nop plus an ELF note,
+ * nothing runs until perf / bpftrace attaches, so they can stay in production builds;
+ * Enabled automatically on Linux when <sys/sdt.h> is found, define RING_BUFFER_NO_USDT to leave them out;
+ * Provider "ring_buffer", every probe carries (handle, length, occupancy):
+ *      write_string_entry / write_string_return / write_full
+ *      read_string_entry / read_string_return / read_empty
+ *      find_keyword_entry / find_keyword_return (length: keyword length / distance found, 0: not found)
+ * e.g. bpftrace -e 'usdt:./app:ring_buffer:write_full { @[arg0] = count(); }'
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_PROBES_H_
+#define _RING_BUFFER_PROBES_H_
+
+#if defined(__linux__) && !defined(RING_BUFFER_NO_USDT) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define RING_BUFFER_USDT
+#endif
+#endif
+
+#ifdef RING_BUFFER_USDT
+#define RING_BUFFER_PROBE(name, handle, size) \
+    DTRACE_PROBE3(ring_buffer, name, (handle), (uint32_t)(size), (uint32_t)RING_BUFFER_LENGTH(handle))
+#else
+#define RING_BUFFER_PROBE(name, handle, size) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,153 @@
+/**
+ * \file ring_buffer_sequence.c
+ * \brief Sequenced slot ring buffer with dependent consumer stages implementation
+ * \details Slots are claimed by sequence number, filled in place and published by one producer;
+ * Consumer stages (decode -> enrich -> persist ...) each run in their own thread with their own cursor,
+ * a stage only sees slots its upstream stage has committed, so all stages work in place on the same slots without copying;
+ * The producer reuses a slot only after every stage has committed it;
+ * Each cursor is on its own cache line and every side caches the cursor it waits on, reloading it only when it runs out;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+*/
+
+#include "ring_buffer_sequence.h"
+
+/**
+ * \brief Initialization new buffer
+ * \param[out] ring_buffer_handle: Buffer structure handle to be initialized
+ * \param[in] buffer_addr: Array of external definitions, at least slot_size * slot_count bytes
+ * \param[in] slot_size: Size of one slot in bytes
+ * \param[in] slot_count: Number of slots, must be a power of two
+ * \return Returns the result of the buffer initialization
+ *      \arg RING_BUFFER_SUCCESS: Initialization successful
+ *      \arg RING_BUFFER_ERROR: initialization failed
+*/
+uint8_t Ring_Buffer_Sequence_Init(ring_buffer_sequence *ring_buffer_handle, void *buffer_addr, uint32_t slot_size, uint32_t slot_count)
+{
+    ring_buffer_handle->array_addr = (uint8_t *)buffer_addr;
+    ring_buffer_handle->slot_size = slot_size;
+    ring_buffer_handle->slot_count = slot_count;
+    ring_buffer_handle->mask = slot_count - 1;
+    ring_buffer_handle->stage_count = 0;
+    atomic_init(&ring_buffer_handle->published, 0);
+    ring_buffer_handle->claimed = 0;
+    ring_buffer_handle->cached_gate = 0;
+    if (slot_size == 0 || slot_count == 0 || (slot_count & (slot_count - 1)) != 0 || slot_count > 0x80000000u)
+        return RING_BUFFER_ERROR;
+    else
+        return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Add a consumer stage, call before the producer starts
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] depend: Upstream stage id, or RING_BUFFER_SEQUENCE_PRODUCER to follow the producer directly
+ * \param[out] stage_id: Id of the new stage
+ * \return Return the result
+ *      \arg RING_BUFFER_SUCCESS: Stage added
+ *      \arg RING_BUFFER_ERROR: Too many stages or unknown upstream stage
+*/
+uint8_t Ring_Buffer_Sequence_Add_Stage(ring_buffer_sequence *ring_buffer_handle, uint8_t depend, uint8_t *stage_id)
+{
+    ring_buffer_stage *stage;
+    if (ring_buffer_handle->stage_count == RING_BUFFER_SEQUENCE_MAX_STAGES ||
+        (depend != RING_BUFFER_SEQUENCE_PRODUCER && depend >= ring_buffer_handle->stage_count))
+        return RING_BUFFER_ERROR;
+    stage = &ring_buffer_handle->stages[ring_buffer_handle->stage_count];
+    atomic_init(&stage->cursor, ring_buffer_handle->claimed);
+    stage->cached_limit = ring_buffer_handle->claimed;
+    stage->depend = depend;
+    *stage_id = ring_buffer_handle->stage_count++;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Claim slots for writing, producer only
+ * \details The claimed slots are filled in place through Ring_Buffer_Sequence_Get_Slot, then made visible with Ring_Buffer_Sequence_Publish
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] slot_number: Number of slots to claim
+ * \param[out] first_sequence: Sequence of the first claimed slot
+ * \return Return the result
+ *      \arg RING_BUFFER_SUCCESS: Claim success
+ *      \arg RING_BUFFER_ERROR: Not enough slots committed by the slowest stage
+*/
+uint8_t Ring_Buffer_Sequence_Claim(ring_buffer_sequence *ring_buffer_handle, uint32_t slot_number, uint32_t *first_sequence)
+{
+    uint32_t claimed = ring_buffer_handle->claimed;
+    if (ring_buffer_handle->slot_count - (claimed - ring_buffer_handle->cached_gate) < slot_number)
+    {
+        //Looks full, find the slowest stage again
+        uint32_t gate = claimed;
+        uint8_t i;
+        for (i = 0; i < ring_buffer_handle->stage_count; i++)
+        {
+            uint32_t cursor = atomic_load_explicit(&ring_buffer_handle->stages[i].cursor, memory_order_acquire);
+            if (claimed - cursor > claimed - gate)
+                gate = cursor;
+        }
+        ring_buffer_handle->cached_gate = gate;
+        if (ring_buffer_handle->slot_count - (claimed - gate) < slot_number)
+            return RING_BUFFER_ERROR;
+    }
+    *first_sequence = claimed;
+    ring_buffer_handle->claimed = claimed + slot_number;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Publish all claimed slots to the stages, producer only
+ * \param[in] ring_buffer_handle: Buffer structure
+*/
+void Ring_Buffer_Sequence_Publish(ring_buffer_sequence *ring_buffer_handle)
+{
+    atomic_store_explicit(&ring_buffer_handle->published, ring_buffer_handle->claimed, memory_order_release);
+}
+
+/**
+ * \brief Get the slots one stage can process, called by the thread of that stage
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] stage_id: Id of the stage
+ * \param[out] first_sequence: Sequence of the first slot to process
+ * \return Returns the number of slots ready for this stage, 0 if upstream has nothing new
+*/
+uint32_t Ring_Buffer_Sequence_Available(ring_buffer_sequence *ring_buffer_handle, uint8_t stage_id, uint32_t *first_sequence)
+{
+    ring_buffer_stage *stage = &ring_buffer_handle->stages[stage_id];
+    uint32_t cursor = atomic_load_explicit(&stage->cursor, memory_order_relaxed);
+    *first_sequence = cursor;
+    if (stage->cached_limit == cursor) //Used up what was seen last time, look at upstream again
+    {
+        if (stage->depend == RING_BUFFER_SEQUENCE_PRODUCER)
+            stage->cached_limit = atomic_load_explicit(&ring_buffer_handle->published, memory_order_acquire);
+        else
+            stage->cached_limit = atomic_load_explicit(&ring_buffer_handle->stages[stage->depend].cursor, memory_order_acquire);
+    }
+    return stage->cached_limit - cursor;
+}
+
+/**
+ * \brief Mark slots as processed by one stage, downstream stages (or the producer) may use them afterwards
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] stage_id: Id of the stage
+ * \param[in] slot_number: Number of slots processed, no more than Ring_Buffer_Sequence_Available returned
+*/
+void Ring_Buffer_Sequence_Commit(ring_buffer_sequence *ring_buffer_handle, uint8_t stage_id, uint32_t slot_number)
+{
+    ring_buffer_stage *stage = &ring_buffer_handle->stages[stage_id];
+    uint32_t cursor = atomic_load_explicit(&stage->cursor, memory_order_relaxed);
+    atomic_store_explicit(&stage->cursor, cursor + slot_number, memory_order_release);
+}
+
+/**
+ * \brief Get the slot address of a sequence
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] sequence: Sequence number of the slot
+ * \return Return the slot address
+*/
+void *Ring_Buffer_Sequence_Get_Slot(ring_buffer_sequence *ring_buffer_handle, uint32_t sequence)
+{
+    return ring_buffer_handle->array_addr + (size_t)(sequence & ring_buffer_handle->mask) * ring_buffer_handle->slot_size;
+}
@@ -0,0 +1,55 @@
+/**
+ * \file ring_buffer_sequence.h
+ * \brief Sequenced slot ring buffer with dependent consumer stages correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_SEQUENCE_H_
+#define _RING_BUFFER_SEQUENCE_H_
+
+#include <stdatomic.h>
+#include "ring_buffer_spsc.h"
+
+// Maximum number of consumer stages
+#ifndef RING_BUFFER_SEQUENCE_MAX_STAGES
+#define RING_BUFFER_SEQUENCE_MAX_STAGES     8
+#endif
+
+// Dependency value of a stage that follows the producer directly
+#define RING_BUFFER_SEQUENCE_PRODUCER       0xFF
+
+// Consumer stage cursor, each stage on its own cache line
+typedef struct
+{
+    _Alignas(RING_BUFFER_CACHE_LINE) _Atomic uint32_t cursor; //Next sequence this stage will process, written by the stage only
+    uint32_t cached_limit;                                    //Last upstream cursor seen by this stage
+    uint8_t depend;                                           //Upstream stage id or RING_BUFFER_SEQUENCE_PRODUCER
+} ring_buffer_stage;
+
+// Sequenced ring buffer structure, sequences are free-running counters, slot index is sequence & mask
+typedef struct
+{
+    //Read-only after initialization
+    _Alignas(RING_BUFFER_CACHE_LINE) uint8_t *array_addr; //Slot storage base address
+    uint32_t slot_size;                                   //Size of one slot in bytes
+    uint32_t slot_count;                                  //Number of slots, power of two
+    uint32_t mask;                                        //slot_count - 1
+    uint8_t stage_count;                                  //Number of stages added
+    //Producer cache line
+    _Alignas(RING_BUFFER_CACHE_LINE) _Atomic uint32_t published; //Slots before this sequence are visible to the stages
+    uint32_t claimed;                                            //Slots before this sequence are claimed by the producer
+    uint32_t cached_gate;                                        //Last slowest stage cursor seen by the producer
+    ring_buffer_stage stages[RING_BUFFER_SEQUENCE_MAX_STAGES];   //Consumer stages
+} ring_buffer_sequence;
+
+uint8_t Ring_Buffer_Sequence_Init(ring_buffer_sequence *ring_buffer_handle, void *buffer_addr, uint32_t slot_size, uint32_t slot_count); //Initialization new buffer
+uint8_t Ring_Buffer_Sequence_Add_Stage(ring_buffer_sequence *ring_buffer_handle, uint8_t depend, uint8_t *stage_id);                      //Add a consumer stage after the producer or another stage
+uint8_t Ring_Buffer_Sequence_Claim(ring_buffer_sequence *ring_buffer_handle, uint32_t slot_number, uint32_t *first_sequence);             //Claim slots for writing (producer)
+void Ring_Buffer_Sequence_Publish(ring_buffer_sequence *ring_buffer_handle);                                                              //Publish all claimed slots to the stages (producer)
+uint32_t Ring_Buffer_Sequence_Available(ring_buffer_sequence *ring_buffer_handle, uint8_t stage_id, uint32_t *first_sequence);            //Get the slots one stage can process (stage)
+void Ring_Buffer_Sequence_Commit(ring_buffer_sequence *ring_buffer_handle, uint8_t stage_id, uint32_t slot_number);                       //Mark slots as processed by one stage (stage)
+void *Ring_Buffer_Sequence_Get_Slot(ring_buffer_sequence *ring_buffer_handle, uint32_t sequence);                                         //Get the slot address of a sequence
+
+#endif
@@ -0,0 +1,256 @@
+/**
+ * \file ring_buffer_shm.c
+ * \brief Shared-memory inter-process ring buffer implementation (POSIX)
+ * \details The control block and the data live in one POSIX shared memory object (shm_open), the control block stores
+ * an offset instead of the array_addr pointer, so every process maps it at any address;
+ * One producer process and one consumer process exchange data through the ring, after Create / Attach the read and write
+ * path is plain memory access plus atomic head / tail, no system call; use one shared buffer per consumer process;
+ * Head and tail are on separate cache lines and each process caches the remote pointer as in ring_buffer_spsc;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.1.3
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+ * 2026.10.16 v1.1.0 String copies go through RING_BUFFER_COPY_IN / OUT (non-temporal large transfers)
+ * 2026.10.16 v1.1.1 Size arithmetic uses the size validated at attach, a corrupted head / tail fails the transfer
+ * 2026.10.16 v1.1.2 Define _GNU_SOURCE so fchmod / ftruncate are declared under -std=c11
+ * 2026.10.16 v1.1.3 Create fails when the access mode can not be set
+*/
+
+#define _GNU_SOURCE
+#include "ring_buffer_shm.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Data starts on the cache line after the control block
+#define RING_BUFFER_SHM_DATA_OFFSET ((sizeof(ring_buffer_shm_ctrl) + RING_BUFFER_CACHE_LINE - 1) & ~(size_t)(RING_BUFFER_CACHE_LINE - 1))
+
+/**
+ * \brief Map a shared memory object and fill the process-local handle (private function)
+ * \param[out] ring_buffer_handle: Process-local handle
+ * \param[in] fd: Shared memory object descriptor
+ * \param[in] map_size: Mapping size
+ * \return Return the mapping result
+ *      \arg RING_BUFFER_SUCCESS: Map success
+ *      \arg RING_BUFFER_ERROR: Map failure
+*/
+static uint8_t Ring_Buffer_SHM_Map(ring_buffer_shm *ring_buffer_handle, int fd, size_t map_size)
+{
+    void *map_addr = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd); //The mapping keeps the object alive
+    if (map_addr == MAP_FAILED)
+        return RING_BUFFER_ERROR;
+    ring_buffer_handle->ctrl = (ring_buffer_shm_ctrl *)map_addr;
+    ring_buffer_handle->map_size = map_size;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Create a shared buffer, called by the producer process
+ * \param[out] ring_buffer_handle: Process-local handle to be initialized
+ * \param[in] name: Shared memory object name, "/name" form
+ * \param[in] buffer_size: Buffer size, must be a power of two
+ * \param[in] mode: Access mode of the object, e.g. 0660 to let a group of consumer processes attach
+ * \return Returns the result of the buffer initialization
+ *      \arg RING_BUFFER_SUCCESS: Initialization successful
+ *      \arg RING_BUFFER_ERROR: initialization failed (bad size, the name already exists or system error)
+*/
+uint8_t Ring_Buffer_SHM_Create(ring_buffer_shm *ring_buffer_handle, const char *name, uint32_t buffer_size, mode_t mode)
+{
+    size_t map_size = RING_BUFFER_SHM_DATA_OFFSET + (size_t)buffer_size;
+    ring_buffer_shm_ctrl *ctrl;
+    int fd;
+    if (buffer_size < 2 || (buffer_size & (buffer_size - 1)) != 0 || buffer_size > 0x80000000u)
+        return RING_BUFFER_ERROR;
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, mode);
+    if (fd < 0)
+        return RING_BUFFER_ERROR;
+    //shm_open applies umask, set the requested mode explicitly
+    if (fchmod(fd, mode) != 0 || ftruncate(fd, (off_t)map_size) != 0)
+    {
+        close(fd);
+        shm_unlink(name);
+        return RING_BUFFER_ERROR;
+    }
+    if (Ring_Buffer_SHM_Map(ring_buffer_handle, fd, map_size) == RING_BUFFER_ERROR)
+    {
+        shm_unlink(name);
+        return RING_BUFFER_ERROR;
+    }
+    ctrl = ring_buffer_handle->ctrl;
+    ctrl->max_length = buffer_size;
+    ctrl->data_offset = (uint32_t)RING_BUFFER_SHM_DATA_OFFSET;
+    atomic_store_explicit(&ctrl->tail, 0, memory_order_relaxed);
+    atomic_store_explicit(&ctrl->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&ctrl->magic, RING_BUFFER_SHM_MAGIC, memory_order_release); //Publish the initialized control block
+    ring_buffer_handle->array_addr = (uint8_t *)ctrl + ctrl->data_offset;
+    ring_buffer_handle->mask = buffer_size - 1;
+    ring_buffer_handle->cached_head = 0;
+    ring_buffer_handle->cached_tail = 0;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Attach to a shared buffer created by another process, called by the consumer process
+ * \param[out] ring_buffer_handle: Process-local handle to be initialized
+ * \param[in] name: Shared memory object name given to Ring_Buffer_SHM_Create
+ * \return Returns the result of the attach
+ *      \arg RING_BUFFER_SUCCESS: Attach successful
+ *      \arg RING_BUFFER_ERROR: Attach failed (no such object, not initialized yet or damaged)
+*/
+uint8_t Ring_Buffer_SHM_Attach(ring_buffer_shm *ring_buffer_handle, const char *name)
+{
+    struct stat shm_stat;
+    ring_buffer_shm_ctrl *ctrl;
+    uint32_t max_length, data_offset;
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0)
+        return RING_BUFFER_ERROR;
+    if (fstat(fd, &shm_stat) != 0 || (size_t)shm_stat.st_size < RING_BUFFER_SHM_DATA_OFFSET + 2)
+    {
+        close(fd);
+        return RING_BUFFER_ERROR;
+    }
+    if (Ring_Buffer_SHM_Map(ring_buffer_handle, fd, (size_t)shm_stat.st_size) == RING_BUFFER_ERROR)
+        return RING_BUFFER_ERROR;
+    ctrl = ring_buffer_handle->ctrl;
+    //The control block is shared, read the geometry once and only use the validated local copy from now on
+    if (atomic_load_explicit(&ctrl->magic, memory_order_acquire) != RING_BUFFER_SHM_MAGIC)
+    {
+        Ring_Buffer_SHM_Detach(ring_buffer_handle);
+        return RING_BUFFER_ERROR;
+    }
+    max_length = ctrl->max_length;
+    data_offset = ctrl->data_offset;
+    if ((size_t)data_offset + max_length > ring_buffer_handle->map_size ||
+        max_length < 2 || (max_length & (max_length - 1)) != 0)
+    {
+        Ring_Buffer_SHM_Detach(ring_buffer_handle);
+        return RING_BUFFER_ERROR;
+    }
+    ring_buffer_handle->array_addr = (uint8_t *)ctrl + data_offset;
+    ring_buffer_handle->mask = max_length - 1;
+    ring_buffer_handle->cached_head = atomic_load_explicit(&ctrl->head, memory_order_acquire);
+    ring_buffer_handle->cached_tail = atomic_load_explicit(&ctrl->tail, memory_order_acquire);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Write the data of the specified length to the tail of the buffer, producer process only
+ * \param[in] ring_buffer_handle: Process-local handle
+ * \param[in] input_addr: Base site to be written to
+ * \param[in] write_lenght: Number of bytes to be written
+ * \return Returns the result of the write
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure, not enough space or the head pointer is corrupted
+*/
+uint8_t Ring_Buffer_SHM_Write_String(ring_buffer_shm *ring_buffer_handle, const void *input_addr, uint32_t write_lenght)
+{
+    ring_buffer_shm_ctrl *ctrl = ring_buffer_handle->ctrl;
+    uint32_t size = ring_buffer_handle->mask + 1; //Validated at attach, ctrl->max_length may be changed by the other process
+    uint32_t tail = atomic_load_explicit(&ctrl->tail, memory_order_relaxed);
+    uint32_t used = tail - ring_buffer_handle->cached_head, offset, write_size_a;
+    if (used > size || size - used < write_lenght) //Looks full, reload the consumer's head
+    {
+        ring_buffer_handle->cached_head = atomic_load_explicit(&ctrl->head, memory_order_acquire);
+        used = tail - ring_buffer_handle->cached_head;
+        if (used > size || size - used < write_lenght) //More data than the buffer holds: corrupted ring
+            return RING_BUFFER_ERROR;
+    }
+    offset = tail & ring_buffer_handle->mask;
+    write_size_a = size - offset;
+    if (write_size_a >= write_lenght)
+        RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr + offset, input_addr, write_lenght);
+    else //Need to write twice
+    {
+        RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr + offset, input_addr, write_size_a);
+        RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr, (const uint8_t *)input_addr + write_size_a, write_lenght - write_size_a);
+    }
+    atomic_store_explicit(&ctrl->tail, tail + write_lenght, memory_order_release);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Read the data of the specified length from the buffer header, consumer process only
+ * \param[in] ring_buffer_handle: Process-local handle
+ * \param[out] output_addr: Read data saved address
+ * \param[in] read_lenght: Number of bytes to read
+ * \return Returns the result of the read
+ *      \arg RING_BUFFER_SUCCESS: Read success
+ *      \arg RING_BUFFER_ERROR: Read failure, not enough data or the tail pointer is corrupted
+*/
+uint8_t Ring_Buffer_SHM_Read_String(ring_buffer_shm *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght)
+{
+    ring_buffer_shm_ctrl *ctrl = ring_buffer_handle->ctrl;
+    uint32_t size = ring_buffer_handle->mask + 1; //Validated at attach, ctrl->max_length may be changed by the other process
+    uint32_t head = atomic_load_explicit(&ctrl->head, memory_order_relaxed);
+    uint32_t offset, read_size_a;
+    if (ring_buffer_handle->cached_tail - head < read_lenght) //Looks empty, reload the producer's tail
+    {
+        ring_buffer_handle->cached_tail = atomic_load_explicit(&ctrl->tail, memory_order_acquire);
+        if (ring_buffer_handle->cached_tail - head < read_lenght)
+            return RING_BUFFER_ERROR;
+    }
+    if (ring_buffer_handle->cached_tail - head > size) //More data than the buffer holds: corrupted ring
+        return RING_BUFFER_ERROR;
+    offset = head & ring_buffer_handle->mask;
+    read_size_a = size - offset;
+    if (read_size_a >= read_lenght)
+        RING_BUFFER_COPY_OUT(output_addr, ring_buffer_handle->array_addr + offset, read_lenght);
+    else //Need to read twice
+    {
+        RING_BUFFER_COPY_OUT(output_addr, ring_buffer_handle->array_addr + offset, read_size_a);
+        RING_BUFFER_COPY_OUT(output_addr + read_size_a, ring_buffer_handle->array_addr, read_lenght - read_size_a);
+    }
+    atomic_store_explicit(&ctrl->head, head + read_lenght, memory_order_release);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Get the data length that has been stored in the buffer
+ * \param[in] ring_buffer_handle: Process-local handle
+ * \return Returns the amount of data already stored in the buffer
+*/
+uint32_t Ring_Buffer_SHM_Get_Length(ring_buffer_shm *ring_buffer_handle)
+{
+    uint32_t head = atomic_load_explicit(&ring_buffer_handle->ctrl->head, memory_order_acquire);
+    return atomic_load_explicit(&ring_buffer_handle->ctrl->tail, memory_order_acquire) - head;
+}
+
+/**
+ * \brief Get a buffer available storage space
+ * \param[in] ring_buffer_handle: Process-local handle
+ * \return Return to buffer available storage space
+*/
+uint32_t Ring_Buffer_SHM_Get_FreeSize(ring_buffer_shm *ring_buffer_handle)
+{
+    uint32_t size = ring_buffer_handle->mask + 1, lenght = Ring_Buffer_SHM_Get_Length(ring_buffer_handle);
+    return lenght < size ? size - lenght : 0; //A corrupted ring has no free space
+}
+
+/**
+ * \brief Unmap the shared buffer from this process, the object stays until Ring_Buffer_SHM_Unlink
+ * \param[in] ring_buffer_handle: Process-local handle, it can not be used after detach
+*/
+void Ring_Buffer_SHM_Detach(ring_buffer_shm *ring_buffer_handle)
+{
+    if (ring_buffer_handle->ctrl != NULL)
+        munmap(ring_buffer_handle->ctrl, ring_buffer_handle->map_size);
+    ring_buffer_handle->ctrl = NULL;
+    ring_buffer_handle->array_addr = NULL;
+}
+
+/**
+ * \brief Remove the shared memory object name, processes still attached keep working
+ * \param[in] name: Shared memory object name
+ * \return Return the result
+ *      \arg RING_BUFFER_SUCCESS: Removed
+ *      \arg RING_BUFFER_ERROR: No such object
+*/
+uint8_t Ring_Buffer_SHM_Unlink(const char *name)
+{
+    return (shm_unlink(name) == 0) ? RING_BUFFER_SUCCESS : RING_BUFFER_ERROR;
+}
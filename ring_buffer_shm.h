@@ -0,0 +1,49 @@
+/**
+ * \file ring_buffer_shm.h
+ * \brief Shared-memory inter-process ring buffer correlation definition and statement (POSIX)
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_SHM_H_
+#define _RING_BUFFER_SHM_H_
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include "ring_buffer_spsc.h"
+
+#define RING_BUFFER_SHM_MAGIC       0x52425348 //"RBSH"
+
+// Control block at the start of the shared memory object, it holds no pointer, only offsets valid in every process
+typedef struct
+{
+    _Alignas(RING_BUFFER_CACHE_LINE) _Atomic uint32_t magic; //RING_BUFFER_SHM_MAGIC once the creator finished the initialization
+    uint32_t max_length;                                     //Buffer maximum storage data amount, power of two
+    uint32_t data_offset;                                    //Data offset from the start of the shared memory object
+    _Alignas(RING_BUFFER_CACHE_LINE) _Atomic uint32_t tail;  //Operate tail pointer, written by the producer process only
+    _Alignas(RING_BUFFER_CACHE_LINE) _Atomic uint32_t head;  //Operating head pointer, written by the consumer process only
+} ring_buffer_shm_ctrl;
+
+// Process-local handle of a shared ring buffer
+typedef struct
+{
+    ring_buffer_shm_ctrl *ctrl; //Control block in this process's mapping
+    uint8_t *array_addr;        //Data base address in this process's mapping
+    uint32_t mask;              //max_length - 1
+    uint32_t cached_head;       //Last head seen by this process (producer side)
+    uint32_t cached_tail;       //Last tail seen by this process (consumer side)
+    size_t map_size;            //Mapping size
+} ring_buffer_shm;
+
+uint8_t Ring_Buffer_SHM_Create(ring_buffer_shm *ring_buffer_handle, const char *name, uint32_t buffer_size, mode_t mode);  //Create a shared buffer (producer process)
+uint8_t Ring_Buffer_SHM_Attach(ring_buffer_shm *ring_buffer_handle, const char *name);                                    //Attach to a shared buffer (consumer process)
+uint8_t Ring_Buffer_SHM_Write_String(ring_buffer_shm *ring_buffer_handle, const void *input_addr, uint32_t write_lenght); //Write the specified length data to the buffer (producer)
+uint8_t Ring_Buffer_SHM_Read_String(ring_buffer_shm *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght);     //Read the specified length data from the buffer (consumer)
+uint32_t Ring_Buffer_SHM_Get_Length(ring_buffer_shm *ring_buffer_handle);                                                 //Get the data length that has been stored in the buffer
+uint32_t Ring_Buffer_SHM_Get_FreeSize(ring_buffer_shm *ring_buffer_handle);                                               //Get a buffer available storage space
+void Ring_Buffer_SHM_Detach(ring_buffer_shm *ring_buffer_handle);                                                         //Unmap the shared buffer from this process
+uint8_t Ring_Buffer_SHM_Unlink(const char *name);                                                                         //Remove the shared memory object name
+
+#endif
@@ -0,0 +1,267 @@
+/**
+ * \file ring_buffer_spsc.c
+ * \brief Single-producer single-consumer lock-free ring buffer implementation
+ * \details One thread (or interrupt) writes, another reads, no lock is needed;
+ * Producer state and consumer state sit on separate cache lines, so the two sides never write the same line;
+ * Each side keeps a copy of the other side's pointer and only reloads the shared one when its copy says full / empty,
+ * so a burst of writes or reads costs about one cache miss on the remote pointer instead of one per call;
+ * Optionally the producer stages data and publishes tail only every publish_batch bytes (or on Ring_Buffer_SPSC_Flush),
+ * and the consumer releases head only every release_batch bytes (or on Ring_Buffer_SPSC_Release), one release-store per batch;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.2.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+ * 2026.10.16 v1.1.0 Add batched tail publication and head release
+ * 2026.10.16 v1.2.0 String copies go through RING_BUFFER_COPY_IN / OUT (non-temporal large transfers)
+*/
+
+#include "ring_buffer_spsc.h"
+
+/**
+ * \brief Initialization new buffer
+ * \param[out] ring_buffer_handle: Buffer structure handle to be initialized
+ * \param[in] buffer_addr: Array of external definitions, type must be uint8_t
+ * \param[in] buffer_size: External defined buffer array space, must be a power of two
+ * \return Returns the result of the buffer initialization
+ *      \arg RING_BUFFER_SUCCESS: Initialization successful
+ *      \arg RING_BUFFER_ERROR: initialization failed
+*/
+uint8_t Ring_Buffer_SPSC_Init(ring_buffer_spsc *ring_buffer_handle, uint8_t *buffer_addr, uint32_t buffer_size)
+{
+    ring_buffer_handle->array_addr = buffer_addr;
+    ring_buffer_handle->max_length = buffer_size;
+    ring_buffer_handle->mask = buffer_size - 1;
+    atomic_init(&ring_buffer_handle->tail, 0);
+    ring_buffer_handle->cached_head = 0;
+    ring_buffer_handle->tail_local = 0;
+    ring_buffer_handle->publish_batch = 1; //Publish every write by default
+    atomic_init(&ring_buffer_handle->head, 0);
+    ring_buffer_handle->cached_tail = 0;
+    ring_buffer_handle->head_local = 0;
+    ring_buffer_handle->release_batch = 1; //Release every read by default
+    //Buffer arrays must have two elements or more, a power of two, and the free-running counters must not be ambiguous
+    if (buffer_size < 2 || (buffer_size & (buffer_size - 1)) != 0 || buffer_size > 0x80000000u)
+        return RING_BUFFER_ERROR;
+    else
+        return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Producer side free space, the shared head pointer is only reloaded when the cached one is not enough
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] tail: Producer's current tail pointer
+ * \param[in] need: Amount of space the caller needs
+ * \return Return to buffer available storage space
+*/
+static uint32_t Ring_Buffer_SPSC_Producer_Free(ring_buffer_spsc *ring_buffer_handle, uint32_t tail, uint32_t need)
+{
+    uint32_t free_size = ring_buffer_handle->max_length - (tail - ring_buffer_handle->cached_head);
+    if (free_size < need) //Looks full, look at where the consumer really is
+    {
+        ring_buffer_handle->cached_head = atomic_load_explicit(&ring_buffer_handle->head, memory_order_acquire);
+        free_size = ring_buffer_handle->max_length - (tail - ring_buffer_handle->cached_head);
+        if (free_size < need) //Really full, publish the staged data so the consumer can drain it
+            atomic_store_explicit(&ring_buffer_handle->tail, tail, memory_order_release);
+    }
+    return free_size;
+}
+
+/**
+ * \brief Consumer side stored data length, the shared tail pointer is only reloaded when the cached one is not enough
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] head: Consumer's current head pointer
+ * \param[in] need: Amount of data the caller needs
+ * \return Returns the amount of data already stored in the buffer
+*/
+static uint32_t Ring_Buffer_SPSC_Consumer_Length(ring_buffer_spsc *ring_buffer_handle, uint32_t head, uint32_t need)
+{
+    uint32_t lenght = ring_buffer_handle->cached_tail - head;
+    if (lenght < need) //Looks empty, look at where the producer really is
+    {
+        ring_buffer_handle->cached_tail = atomic_load_explicit(&ring_buffer_handle->tail, memory_order_acquire);
+        lenght = ring_buffer_handle->cached_tail - head;
+        if (lenght < need) //Really empty, release the consumed space so the producer can refill it
+            atomic_store_explicit(&ring_buffer_handle->head, head, memory_order_release);
+    }
+    return lenght;
+}
+
+/**
+ * \brief Producer side, publish the staged data once a full batch is reached
+ * \param[in] ring_buffer_handle: Buffer structure
+*/
+static void Ring_Buffer_SPSC_Publish_Check(ring_buffer_spsc *ring_buffer_handle)
+{
+    uint32_t tail = atomic_load_explicit(&ring_buffer_handle->tail, memory_order_relaxed); //Only the producer writes tail
+    if (ring_buffer_handle->tail_local - tail >= ring_buffer_handle->publish_batch)
+        atomic_store_explicit(&ring_buffer_handle->tail, ring_buffer_handle->tail_local, memory_order_release);
+}
+
+/**
+ * \brief Consumer side, release the consumed space once a full batch is reached
+ * \param[in] ring_buffer_handle: Buffer structure
+*/
+static void Ring_Buffer_SPSC_Release_Check(ring_buffer_spsc *ring_buffer_handle)
+{
+    uint32_t head = atomic_load_explicit(&ring_buffer_handle->head, memory_order_relaxed); //Only the consumer writes head
+    if (ring_buffer_handle->head_local - head >= ring_buffer_handle->release_batch)
+        atomic_store_explicit(&ring_buffer_handle->head, ring_buffer_handle->head_local, memory_order_release);
+}
+
+/**
+ * \brief Write one byte to the end of the buffer, producer only
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] rb_data: To write bytes
+ * \return Returns the result of the buffer write byte
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure
+*/
+uint8_t Ring_Buffer_SPSC_Write_Byte(ring_buffer_spsc *ring_buffer_handle, uint8_t rb_data)
+{
+    uint32_t tail = ring_buffer_handle->tail_local;
+    if (Ring_Buffer_SPSC_Producer_Free(ring_buffer_handle, tail, 1) == 0)
+        return RING_BUFFER_ERROR; //The buffer is full
+    ring_buffer_handle->array_addr[tail & ring_buffer_handle->mask] = rb_data;
+    ring_buffer_handle->tail_local = tail + 1;
+    Ring_Buffer_SPSC_Publish_Check(ring_buffer_handle); //Publish the data to the consumer
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Read a byte from the buffer head pointer, consumer only
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] rb_data: Read byte saved address
+ * \return Returns the result of the buffer read byte
+ *      \arg RING_BUFFER_SUCCESS: Read success
+ *      \arg RING_BUFFER_ERROR: Read failure, the buffer is empty
+*/
+uint8_t Ring_Buffer_SPSC_Read_Byte(ring_buffer_spsc *ring_buffer_handle, uint8_t *rb_data)
+{
+    uint32_t head = ring_buffer_handle->head_local;
+    if (Ring_Buffer_SPSC_Consumer_Length(ring_buffer_handle, head, 1) == 0)
+        return RING_BUFFER_ERROR; //The buffer is empty
+    *rb_data = ring_buffer_handle->array_addr[head & ring_buffer_handle->mask];
+    ring_buffer_handle->head_local = head + 1;
+    Ring_Buffer_SPSC_Release_Check(ring_buffer_handle); //Give the space back to the producer
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Write the data of the specified length to the tail of the buffer, producer only
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] input_addr: Base site to be written to
+ * \param[in] write_lenght: Number of bytes to be written
+ * \return Returns the result of the end of the buffer to write the specified length byte
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure
+*/
+uint8_t Ring_Buffer_SPSC_Write_String(ring_buffer_spsc *ring_buffer_handle, const void *input_addr, uint32_t write_lenght)
+{
+    uint32_t tail = ring_buffer_handle->tail_local;
+    uint32_t offset, write_size_a;
+    if (Ring_Buffer_SPSC_Producer_Free(ring_buffer_handle, tail, write_lenght) < write_lenght)
+        return RING_BUFFER_ERROR; //Not enough space to store new data
+    offset = tail & ring_buffer_handle->mask;
+    write_size_a = ring_buffer_handle->max_length - offset; //Write from the tail pointer to the end of the store
+    if (write_size_a >= write_lenght)
+        RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr + offset, input_addr, write_lenght);
+    else //Need to write twice
+    {
+        RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr + offset, input_addr, write_size_a);
+        RING_BUFFER_COPY_IN(ring_buffer_handle->array_addr, (const uint8_t *)input_addr + write_size_a, write_lenght - write_size_a);
+    }
+    ring_buffer_handle->tail_local = tail + write_lenght;
+    Ring_Buffer_SPSC_Publish_Check(ring_buffer_handle);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Read the data of the specified length to the buffer header, consumer only
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[out] output_addr: Read data saved address
+ * \param[in] read_lenght: Number of bytes to read
+ * \return Returns the result of the buffer header read the specified length byte
+ *      \arg RING_BUFFER_SUCCESS: Read success
+ *      \arg RING_BUFFER_ERROR: Read failure
+*/
+uint8_t Ring_Buffer_SPSC_Read_String(ring_buffer_spsc *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght)
+{
+    uint32_t head = ring_buffer_handle->head_local;
+    uint32_t offset, read_size_a;
+    if (Ring_Buffer_SPSC_Consumer_Length(ring_buffer_handle, head, read_lenght) < read_lenght)
+        return RING_BUFFER_ERROR; //Not enough data stored
+    offset = head & ring_buffer_handle->mask;
+    read_size_a = ring_buffer_handle->max_length - offset;
+    if (read_size_a >= read_lenght)
+        RING_BUFFER_COPY_OUT(output_addr, ring_buffer_handle->array_addr + offset, read_lenght);
+    else //Need to read twice
+    {
+        RING_BUFFER_COPY_OUT(output_addr, ring_buffer_handle->array_addr + offset, read_size_a);
+        RING_BUFFER_COPY_OUT(output_addr + read_size_a, ring_buffer_handle->array_addr, read_lenght - read_size_a);
+    }
+    ring_buffer_handle->head_local = head + read_lenght;
+    Ring_Buffer_SPSC_Release_Check(ring_buffer_handle);
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Set the producer publish / consumer release batch size, call before the two sides start working
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] publish_batch: Publish tail once this many bytes are staged, 1 publishes every write
+ * \param[in] release_batch: Release head once this many bytes are consumed, 1 releases every read
+ * \return Returns the result of the setting
+ *      \arg RING_BUFFER_SUCCESS: Set success
+ *      \arg RING_BUFFER_ERROR: Batch size is 0 or larger than the buffer, it would never be published / released
+*/
+uint8_t Ring_Buffer_SPSC_Set_Batch(ring_buffer_spsc *ring_buffer_handle, uint32_t publish_batch, uint32_t release_batch)
+{
+    if (publish_batch == 0 || publish_batch > ring_buffer_handle->max_length ||
+        release_batch == 0 || release_batch > ring_buffer_handle->max_length)
+        return RING_BUFFER_ERROR;
+    ring_buffer_handle->publish_batch = publish_batch;
+    ring_buffer_handle->release_batch = release_batch;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Publish all staged data to the consumer, producer only
+ * \param[in] ring_buffer_handle: Buffer structure
+*/
+void Ring_Buffer_SPSC_Flush(ring_buffer_spsc *ring_buffer_handle)
+{
+    atomic_store_explicit(&ring_buffer_handle->tail, ring_buffer_handle->tail_local, memory_order_release);
+}
+
+/**
+ * \brief Give all consumed space back to the producer, consumer only
+ * \param[in] ring_buffer_handle: Buffer structure
+*/
+void Ring_Buffer_SPSC_Release(ring_buffer_spsc *ring_buffer_handle)
+{
+    atomic_store_explicit(&ring_buffer_handle->head, ring_buffer_handle->head_local, memory_order_release);
+}
+
+/**
+ * \brief Get the data length that can be read from the buffer, consumer side view
+ * \details Only published data is counted, data staged by the producer becomes visible after the batch is published
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \return Returns the amount of data already stored in the buffer
+*/
+uint32_t Ring_Buffer_SPSC_Get_Length(ring_buffer_spsc *ring_buffer_handle)
+{
+    ring_buffer_handle->cached_tail = atomic_load_explicit(&ring_buffer_handle->tail, memory_order_acquire);
+    return ring_buffer_handle->cached_tail - ring_buffer_handle->head_local;
+}
+
+/**
+ * \brief Get a buffer available storage space, producer side view
+ * \details Space consumed but not yet released by the consumer is not counted
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \return Return to buffer available storage space
+*/
+uint32_t Ring_Buffer_SPSC_Get_FreeSize(ring_buffer_spsc *ring_buffer_handle)
+{
+    ring_buffer_handle->cached_head = atomic_load_explicit(&ring_buffer_handle->head, memory_order_acquire);
+    return ring_buffer_handle->max_length - (ring_buffer_handle->tail_local - ring_buffer_handle->cached_head);
+}
@@ -0,0 +1,51 @@
+/**
+ * \file ring_buffer_spsc.h
+ * \brief Single-producer single-consumer lock-free ring buffer correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_SPSC_H_
+#define _RING_BUFFER_SPSC_H_
+
+#include <stdatomic.h>
+#include "ring_buffer.h"
+
+// Cache line size used to separate producer and consumer state
+#ifndef RING_BUFFER_CACHE_LINE
+#define RING_BUFFER_CACHE_LINE      64
+#endif
+
+// SPSC ring buffer structure
+// head / tail are free-running counters, the array offset is counter & mask, so buffer size must be a power of two
+typedef struct
+{
+    //Read-only after initialization, shared by both sides
+    _Alignas(RING_BUFFER_CACHE_LINE) uint8_t *array_addr; //Buffer storage number base address
+    uint32_t max_length;                                  //Buffer maximum storage data amount
+    uint32_t mask;                                        //max_length - 1
+    //Producer cache line
+    _Alignas(RING_BUFFER_CACHE_LINE) _Atomic uint32_t tail; //Published tail pointer, written by the producer only
+    uint32_t cached_head;                                   //Last head seen by the producer
+    uint32_t tail_local;                                    //Producer's tail pointer, data before it is written but may not be published yet
+    uint32_t publish_batch;                                 //Publish tail once this much data is staged
+    //Consumer cache line
+    _Alignas(RING_BUFFER_CACHE_LINE) _Atomic uint32_t head; //Released head pointer, written by the consumer only
+    uint32_t cached_tail;                                   //Last tail seen by the consumer
+    uint32_t head_local;                                    //Consumer's head pointer, data before it is read but may not be released yet
+    uint32_t release_batch;                                 //Release head once this much data is consumed
+} ring_buffer_spsc;
+
+uint8_t Ring_Buffer_SPSC_Init(ring_buffer_spsc *ring_buffer_handle, uint8_t *buffer_addr, uint32_t buffer_size);                //Initialization new buffer
+uint8_t Ring_Buffer_SPSC_Write_Byte(ring_buffer_spsc *ring_buffer_handle, uint8_t rb_data);                                     //Write a byte to the buffer (producer)
+uint8_t Ring_Buffer_SPSC_Read_Byte(ring_buffer_spsc *ring_buffer_handle, uint8_t *rb_data);                                     //Read a byte from the buffer (consumer)
+uint8_t Ring_Buffer_SPSC_Write_String(ring_buffer_spsc *ring_buffer_handle, const void *input_addr, uint32_t write_lenght);     //Write the specified length data to the buffer (producer)
+uint8_t Ring_Buffer_SPSC_Read_String(ring_buffer_spsc *ring_buffer_handle, uint8_t *output_addr, uint32_t read_lenght);         //Read the specified length data from the buffer (consumer)
+uint8_t Ring_Buffer_SPSC_Set_Batch(ring_buffer_spsc *ring_buffer_handle, uint32_t publish_batch, uint32_t release_batch);       //Set the producer publish / consumer release batch size
+void Ring_Buffer_SPSC_Flush(ring_buffer_spsc *ring_buffer_handle);                                                              //Publish all staged data to the consumer (producer)
+void Ring_Buffer_SPSC_Release(ring_buffer_spsc *ring_buffer_handle);                                                            //Give all consumed space back to the producer (consumer)
+uint32_t Ring_Buffer_SPSC_Get_Length(ring_buffer_spsc *ring_buffer_handle);                                                     //Get the data length that has been stored in the buffer (consumer)
+uint32_t Ring_Buffer_SPSC_Get_FreeSize(ring_buffer_spsc *ring_buffer_handle);                                                   //Get a buffer available storage space (producer)
+
+#endif
@@ -0,0 +1,152 @@
+/**
+ * \file ring_buffer_time.c
+ * \brief Ring buffer timestamp index implementation
+ * \details Records (timestamp, stream offset) of the written data in a small element ring buffer beside the data buffer,
+ * at every write or once every interval bytes, so a time range is found by binary search over the entries
+ * instead of scanning the data; the result is returned as spans inside the data buffer, nothing is copied;
+ * Offsets count bytes since the index was attached (64-bit, they never wrap), the data buffer holds the last
+ * RING_BUFFER_LENGTH bytes of that stream, so reads and deletes on the data buffer need no index update;
+ * All writes to the data buffer must go through Ring_Buffer_Time_Write, timestamps must not go backwards;
+ * When the index is full the oldest entry is dropped, entries of data already read are dropped first;
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+*/
+
+#include "ring_buffer_time.h"
+
+/**
+ * \brief Find the first entry with a timestamp at or after a time (private function)
+ * \param[in] index: Timestamp index
+ * \param[in] timestamp: Time to look for
+ * \param[in] after: 0: first entry with timestamp >= time, 1: first entry with timestamp > time
+ * \return Returns the entry position from the oldest one, the entry count when there is none
+*/
+static uint32_t Ring_Buffer_Time_Search(ring_buffer_time *index, uint64_t timestamp, uint8_t after)
+{
+    ring_buffer_time_entry entry;
+    uint32_t low = 0, high = Ring_Buffer_Elem_Get_Length(&index->entries), middle;
+    while (low < high)
+    {
+        middle = low + (high - low) / 2;
+        Ring_Buffer_Elem_Peek(&index->entries, middle, &entry);
+        if (entry.timestamp < timestamp || (after && entry.timestamp == timestamp))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+/**
+ * \brief Attach a timestamp index to a buffer, data already stored is not indexed
+ * \param[out] index: Timestamp index to be initialized
+ * \param[in] ring_buffer_handle: Data buffer structure
+ * \param[in] entry_addr: Array of external definitions for the entries
+ * \param[in] entry_count: Number of entries the array can hold
+ * \param[in] interval: Bytes between entries, 0: one entry per write (exact ranges), larger: fewer entries, ranges rounded out to chunks
+ * \return Returns the result of the initialization
+ *      \arg RING_BUFFER_SUCCESS: Initialization successful
+ *      \arg RING_BUFFER_ERROR: initialization failed
+*/
+uint8_t Ring_Buffer_Time_Init(ring_buffer_time *index, ring_buffer *ring_buffer_handle, ring_buffer_time_entry *entry_addr, uint32_t entry_count, uint32_t interval)
+{
+    index->ring_buffer_handle = ring_buffer_handle;
+    index->written = RING_BUFFER_LENGTH(ring_buffer_handle); //Stored data is the start of the stream, before the first entry
+    index->interval = interval;
+    return Ring_Buffer_Elem_Init(&index->entries, entry_addr, sizeof(ring_buffer_time_entry), entry_count);
+}
+
+/**
+ * \brief Write data to the buffer and index it
+ * \param[in] index: Timestamp index
+ * \param[in] input_addr: Base site to be written to
+ * \param[in] write_lenght: Number of bytes to be written
+ * \param[in] timestamp: Time of the data, not less than the previous one
+ * \return Returns the result of the write
+ *      \arg RING_BUFFER_SUCCESS: Write success
+ *      \arg RING_BUFFER_ERROR: Write failure, nothing is written or indexed
+*/
+uint8_t Ring_Buffer_Time_Write(ring_buffer_time *index, const void *input_addr, uint32_t write_lenght, uint64_t timestamp)
+{
+    ring_buffer_time_entry entry;
+    uint64_t start = index->written - RING_BUFFER_LENGTH(index->ring_buffer_handle); //Stream offset of the head pointer
+    uint32_t count = Ring_Buffer_Elem_Get_Length(&index->entries);
+    if (Ring_Buffer_Write_String(index->ring_buffer_handle, (void *)input_addr, write_lenght) != RING_BUFFER_SUCCESS)
+        return RING_BUFFER_ERROR;
+    //A new chunk starts when the newest one holds interval bytes
+    if (count != 0)
+    {
+        Ring_Buffer_Elem_Peek(&index->entries, count - 1, &entry);
+        if (index->written - entry.offset < index->interval)
+        {
+            index->written += write_lenght;
+            return RING_BUFFER_SUCCESS;
+        }
+    }
+    //Drop entries whose chunk has been read completely (the next entry is not after the head pointer), then the oldest if still full
+    while (Ring_Buffer_Elem_Peek(&index->entries, 1, &entry) == RING_BUFFER_SUCCESS && entry.offset <= start)
+        Ring_Buffer_Elem_Delete(&index->entries, 1);
+    if (Ring_Buffer_Elem_Get_FreeSize(&index->entries) == 0)
+        Ring_Buffer_Elem_Delete(&index->entries, 1);
+    entry.timestamp = timestamp;
+    entry.offset = index->written;
+    Ring_Buffer_Elem_Write(&index->entries, &entry);
+    index->written += write_lenght;
+    return RING_BUFFER_SUCCESS;
+}
+
+/**
+ * \brief Get the stored data written between two times in place, nothing is copied or removed
+ * \details With an interval, the range is rounded out to whole chunks: it starts at the chunk holding start_time
+ * and ends after the chunk holding end_time; data already read from the buffer is left out;
+ * The spans stay valid until the data is read or deleted
+ * \param[in] index: Timestamp index
+ * \param[in] start_time: First time of the range
+ * \param[in] end_time: Last time of the range (included)
+ * \param[out] span: Two spans, span[1].lenght is 0 unless the range wraps
+ * \return Returns the result of the query
+ *      \arg RING_BUFFER_SUCCESS: Range found, the data is in span
+ *      \arg RING_BUFFER_ERROR: No stored data in the range
+*/
+uint8_t Ring_Buffer_Time_Query(ring_buffer_time *index, uint64_t start_time, uint64_t end_time, ring_buffer_span *span)
+{
+    ring_buffer_time_entry entry;
+    ring_buffer_span data[2];
+    uint32_t lenght = Ring_Buffer_Get_Read_Spans(index->ring_buffer_handle, data);
+    uint64_t start = index->written - lenght, range_start, range_end = index->written;
+    uint32_t first = Ring_Buffer_Time_Search(index, start_time, 0);
+    uint32_t last = Ring_Buffer_Time_Search(index, end_time, 1); //First entry after the range
+    if (first != 0 && index->interval != 0)
+        first--; //The chunk before may hold data from start_time on
+    if (first >= last || end_time < start_time)
+        return RING_BUFFER_ERROR;
+    Ring_Buffer_Elem_Peek(&index->entries, first, &entry);
+    range_start = entry.offset > start ? entry.offset : start;
+    if (Ring_Buffer_Elem_Peek(&index->entries, last, &entry) == RING_BUFFER_SUCCESS)
+        range_end = entry.offset;
+    if (range_end <= range_start)
+        return RING_BUFFER_ERROR; //Already read
+    //Cut the range out of the stored data, offsets from the head pointer
+    range_end -= start;
+    range_start -= start;
+    span[0].lenght = 0;
+    span[1].lenght = 0;
+    if (range_start < data[0].lenght)
+    {
+        span[0].addr = data[0].addr + range_start;
+        span[0].lenght = (uint32_t)((range_end < data[0].lenght ? range_end : data[0].lenght) - range_start);
+        span[1].addr = data[1].addr;
+        if (range_end > data[0].lenght)
+            span[1].lenght = (uint32_t)(range_end - data[0].lenght);
+    }
+    else
+    {
+        span[0].addr = data[1].addr + (range_start - data[0].lenght);
+        span[0].lenght = (uint32_t)(range_end - range_start);
+        span[1].addr = data[1].addr;
+    }
+    return RING_BUFFER_SUCCESS;
+}
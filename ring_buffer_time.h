@@ -0,0 +1,35 @@
+/**
+ * \file ring_buffer_time.h
+ * \brief Ring buffer timestamp index correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_TIME_H_
+#define _RING_BUFFER_TIME_H_
+
+#include "ring_buffer.h"
+#include "ring_buffer_elem.h"
+
+// Index entry, where a chunk of data starts and when it was written
+typedef struct
+{
+    uint64_t timestamp; //Time of the first write of the chunk
+    uint64_t offset;    //Stream offset of the chunk, bytes written to the buffer before it
+} ring_buffer_time_entry;
+
+// Timestamp index of a buffer, the entries are kept in their own element ring buffer
+typedef struct
+{
+    ring_buffer *ring_buffer_handle; //Data buffer
+    ring_buffer_elem entries;        //ring_buffer_time_entry, oldest first
+    uint64_t written;                //Stream offset of the tail pointer, bytes written since the index was attached
+    uint32_t interval;               //Bytes between entries, 0: one entry per write
+} ring_buffer_time;
+
+uint8_t Ring_Buffer_Time_Init(ring_buffer_time *index, ring_buffer *ring_buffer_handle, ring_buffer_time_entry *entry_addr, uint32_t entry_count, uint32_t interval); //Attach a timestamp index to a buffer
+uint8_t Ring_Buffer_Time_Write(ring_buffer_time *index, const void *input_addr, uint32_t write_lenght, uint64_t timestamp);                                            //Write data to the buffer and index it
+uint8_t Ring_Buffer_Time_Query(ring_buffer_time *index, uint64_t start_time, uint64_t end_time, ring_buffer_span *span);                                              //Get the stored data written between two times in place
+
+#endif
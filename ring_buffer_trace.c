@@ -0,0 +1,170 @@
+/**
+ * \file ring_buffer_trace.c
+ * \brief Ring buffer occupancy / latency histogram implementation
+ * \details Compiled in with RING_BUFFER_TRACE, the ring buffer functions report every write and read here;
+ * Each write adds the saved data volume to a log-linear histogram, so buffer sizes can be chosen from the real distribution;
+ * Every Nth write is tagged with a timestamp and the stream position of its last byte, when the reads pass that position
+ * the elapsed ticks go to the latency histogram, a stalled consumer shows up as a long tail;
+ * Buckets follow HDR histogram layout: values below RING_BUFFER_TRACE_SUB_COUNT have one bucket each,
+ * above that every power of two is split into RING_BUFFER_TRACE_SUB_COUNT linear buckets
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+ *
+ * 2026.10.16 v1.0.0 Release the first version
+*/
+
+#include "ring_buffer_trace.h"
+
+#ifdef RING_BUFFER_TRACE
+
+/**
+ * \brief Get the bucket of a value (private function)
+ * \param[in] value: Value to count
+ * \return Return the bucket index
+*/
+static uint32_t Ring_Buffer_Trace_Bucket(uint64_t value)
+{
+    uint32_t msb;
+    if (value < RING_BUFFER_TRACE_SUB_COUNT)
+        return (uint32_t)value;
+    msb = 63 - __builtin_clzll(value); //Power of two of the value
+    //Power of two selects the group, the next RING_BUFFER_TRACE_SUB_BITS bits select the linear bucket inside it
+    return (msb - RING_BUFFER_TRACE_SUB_BITS + 1) * RING_BUFFER_TRACE_SUB_COUNT +
+           (uint32_t)(value >> (msb - RING_BUFFER_TRACE_SUB_BITS)) - RING_BUFFER_TRACE_SUB_COUNT;
+}
+
+/**
+ * \brief Initialization new trace state
+ * \param[out] trace: Trace state
+ * \param[in] sample_interval: Timestamp every Nth write for the latency histogram, 0: no latency sampling
+*/
+void Ring_Buffer_Trace_Init(ring_buffer_trace *trace, uint32_t sample_interval)
+{
+    memset(trace, 0, sizeof(ring_buffer_trace));
+    trace->sample_interval = sample_interval;
+}
+
+/**
+ * \brief Start tracing a buffer, stream positions restart from the data already stored
+ * \param[out] ring_buffer_handle: Buffer structure
+ * \param[in] trace: Trace state, NULL: stop tracing
+*/
+void Ring_Buffer_Trace_Attach(ring_buffer *ring_buffer_handle, ring_buffer_trace *trace)
+{
+    if (trace != NULL)
+    {
+        trace->read_position = 0;
+        trace->write_position = RING_BUFFER_LENGTH(ring_buffer_handle); //Data already stored is read first, it is not sampled
+        trace->tag_head = 0;
+        trace->tag_count = 0;
+    }
+    ring_buffer_handle->trace = trace;
+}
+
+/**
+ * \brief Clear the histograms and the waiting samples
+ * \param[out] trace: Trace state
+*/
+void Ring_Buffer_Trace_Reset(ring_buffer_trace *trace)
+{
+    uint32_t sample_interval = trace->sample_interval;
+    uint64_t write_position = trace->write_position, read_position = trace->read_position;
+    memset(trace, 0, sizeof(ring_buffer_trace));
+    trace->sample_interval = sample_interval;
+    trace->write_position = write_position; //Positions keep following the buffer
+    trace->read_position = read_position;
+}
+
+/**
+ * \brief Record a write, called by the ring buffer functions after the data is stored
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] lenght: Bytes written
+*/
+void Ring_Buffer_Trace_Write(ring_buffer *ring_buffer_handle, uint32_t lenght)
+{
+    ring_buffer_trace *trace = ring_buffer_handle->trace;
+    trace->occupancy[Ring_Buffer_Trace_Bucket(RING_BUFFER_LENGTH(ring_buffer_handle))]++;
+    trace->write_position += lenght;
+#ifdef RING_BUFFER_TRACE_CLOCK
+    if (trace->sample_interval != 0 && ++trace->sample_count >= trace->sample_interval)
+    {
+        trace->sample_count = 0;
+        if (trace->tag_count < RING_BUFFER_TRACE_TAGS) //Tag queue full: the consumer is far behind, skip this sample
+        {
+            ring_buffer_trace_tag *tag = &trace->tag[(trace->tag_head + trace->tag_count) % RING_BUFFER_TRACE_TAGS];
+            tag->position = trace->write_position;
+            tag->timestamp = RING_BUFFER_TRACE_CLOCK();
+            trace->tag_count++;
+        }
+    }
+#endif
+}
+
+/**
+ * \brief Record a read, called by the ring buffer functions after the data is removed
+ * \param[in] ring_buffer_handle: Buffer structure
+ * \param[in] lenght: Bytes read or deleted
+*/
+void Ring_Buffer_Trace_Read(ring_buffer *ring_buffer_handle, uint32_t lenght)
+{
+    ring_buffer_trace *trace = ring_buffer_handle->trace;
+    trace->read_position += lenght;
+#ifdef RING_BUFFER_TRACE_CLOCK
+    if (trace->tag_count != 0)
+    {
+        uint64_t now = RING_BUFFER_TRACE_CLOCK();
+        //Every sampled write whose last byte has now left the buffer is complete
+        while (trace->tag_count != 0 && trace->tag[trace->tag_head].position <= trace->read_position)
+        {
+            trace->latency[Ring_Buffer_Trace_Bucket(now - trace->tag[trace->tag_head].timestamp)]++;
+            trace->tag_head = (trace->tag_head + 1) % RING_BUFFER_TRACE_TAGS;
+            trace->tag_count--;
+        }
+    }
+#endif
+}
+
+/**
+ * \brief Get the lowest value counted by a bucket, the bucket covers up to the next bucket value
+ * \param[in] index: Bucket index
+ * \return Return the lowest value of the bucket
+*/
+uint64_t Ring_Buffer_Trace_Bucket_Value(uint32_t index)
+{
+    uint32_t group, sub;
+    if (index < RING_BUFFER_TRACE_SUB_COUNT)
+        return index;
+    group = index / RING_BUFFER_TRACE_SUB_COUNT; //Power of two is group + SUB_BITS - 1
+    sub = index % RING_BUFFER_TRACE_SUB_COUNT;
+    return (uint64_t)(RING_BUFFER_TRACE_SUB_COUNT + sub) << (group - 1);
+}
+
+/**
+ * \brief Get the value below which the given share of samples fall
+ * \param[in] bucket: Histogram, occupancy or latency of a trace state
+ * \param[in] bucket_count: RING_BUFFER_TRACE_OCCUPANCY_BUCKETS / RING_BUFFER_TRACE_LATENCY_BUCKETS
+ * \param[in] permille: Share of samples in 1/1000 (500: median, 990: p99, 1000: max)
+ * \return Return the lowest value of the bucket holding that sample, 0 if the histogram is empty
+*/
+uint64_t Ring_Buffer_Trace_Percentile(const uint32_t *bucket, uint32_t bucket_count, uint32_t permille)
+{
+    uint64_t total = 0, rank, seen = 0;
+    uint32_t i;
+    for (i = 0; i < bucket_count; i++)
+        total += bucket[i];
+    if (total == 0)
+        return 0;
+    rank = (total * permille + 999) / 1000; //Samples needed to reach the share, rounded up
+    if (rank == 0)
+        rank = 1;
+    for (i = 0; i < bucket_count; i++)
+    {
+        seen += bucket[i];
+        if (seen >= rank)
+            return Ring_Buffer_Trace_Bucket_Value(i);
+    }
+    return Ring_Buffer_Trace_Bucket_Value(bucket_count - 1);
+}
+
+#endif
@@ -0,0 +1,71 @@
+/**
+ * \file ring_buffer_trace.h
+ * \brief Ring buffer occupancy / latency histogram correlation definition and statement
+ * \author netube_99\netube@163.com
+ * \date 2026.10.16
+ * \version v1.0.0
+*/
+
+#ifndef _RING_BUFFER_TRACE_H_
+#define _RING_BUFFER_TRACE_H_
+
+#include "ring_buffer.h"
+
+// Sub-buckets per power of two, 2 bits: every bucket is within 25% of its value (HDR-style log-linear buckets)
+#define RING_BUFFER_TRACE_SUB_BITS          2
+#define RING_BUFFER_TRACE_SUB_COUNT         (1u << RING_BUFFER_TRACE_SUB_BITS)
+#define RING_BUFFER_TRACE_BUCKETS(bits)     (((bits) - RING_BUFFER_TRACE_SUB_BITS + 1) * RING_BUFFER_TRACE_SUB_COUNT)
+#define RING_BUFFER_TRACE_OCCUPANCY_BUCKETS RING_BUFFER_TRACE_BUCKETS(32) //Buckets for a 32-bit data volume
+#define RING_BUFFER_TRACE_LATENCY_BUCKETS   RING_BUFFER_TRACE_BUCKETS(64) //Buckets for a 64-bit tick difference
+
+// Number of sampled writes that can wait for their read at the same time, further samples are skipped
+#ifndef RING_BUFFER_TRACE_TAGS
+#define RING_BUFFER_TRACE_TAGS              16
+#endif
+
+// Timestamp source, defaults to the TSC (x86) / virtual counter (AArch64), define it on other targets (e.g. DWT->CYCCNT)
+#ifndef RING_BUFFER_TRACE_CLOCK
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define RING_BUFFER_TRACE_CLOCK()           __rdtsc()
+#elif defined(__aarch64__)
+static inline uint64_t Ring_Buffer_Trace_Counter(void)
+{
+    uint64_t value;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+}
+#define RING_BUFFER_TRACE_CLOCK()           Ring_Buffer_Trace_Counter()
+#endif
+#endif
+
+#ifdef RING_BUFFER_TRACE
+// Sampled write waiting for its read
+typedef struct
+{
+    uint64_t position;  //Stream position of the last byte of the write
+    uint64_t timestamp; //RING_BUFFER_TRACE_CLOCK() at the write
+} ring_buffer_trace_tag;
+
+// Trace state, attached to one buffer
+typedef struct ring_buffer_trace
+{
+    uint32_t occupancy[RING_BUFFER_TRACE_OCCUPANCY_BUCKETS]; //Saved data volume after each write
+    uint32_t latency[RING_BUFFER_TRACE_LATENCY_BUCKETS];     //Clock ticks from a sampled write to the read of its last byte
+    uint64_t write_position;                                 //Bytes written since attach
+    uint64_t read_position;                                  //Bytes read or deleted since attach
+    uint32_t sample_interval;                                //Timestamp every Nth write, 0: no latency sampling
+    uint32_t sample_count;                                   //Writes since the last sample
+    uint32_t tag_head;                                       //Oldest waiting sample
+    uint32_t tag_count;                                      //Number of waiting samples
+    ring_buffer_trace_tag tag[RING_BUFFER_TRACE_TAGS];       //Waiting samples, in write order
+} ring_buffer_trace;
+
+void Ring_Buffer_Trace_Init(ring_buffer_trace *trace, uint32_t sample_interval);                               //Initialization new trace state
+void Ring_Buffer_Trace_Attach(ring_buffer *ring_buffer_handle, ring_buffer_trace *trace);                      //Start tracing a buffer, NULL to stop
+void Ring_Buffer_Trace_Reset(ring_buffer_trace *trace);                                                        //Clear the histograms
+uint64_t Ring_Buffer_Trace_Bucket_Value(uint32_t index);                                                       //Get the lowest value counted by a bucket
+uint64_t Ring_Buffer_Trace_Percentile(const uint32_t *bucket, uint32_t bucket_count, uint32_t permille);       //Get the value below which the given share of samples fall
+#endif
+
+#endif
@@ -1,4 +1,26 @@
 #include "ring_buffer.h"
+#include "ring_buffer_elem.h"
+#include "ring_buffer_spsc.h"
+#include "ring_buffer_broadcast.h"
+#include "ring_buffer_sequence.h"
+#include "ring_buffer_chain.h"
+#include "ring_buffer_crc.h"
+#include "ring_buffer_trace.h"
+#include "ring_buffer_large.h"
+#include "ring_buffer_line.h"
+#include "ring_buffer_frame.h"
+#include "ring_buffer_time.h"
+#ifdef RING_BUFFER_NT_COPY
+#include "ring_buffer_copy.h"
+#endif
+#if defined(__linux__)
+#include "ring_buffer_alloc.h"
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <stddef.h>
+#include "ring_buffer_file.h"
+#include "ring_buffer_shm.h"
+#endif
 
 #define Read_BUFFER_SIZE        256
 
@@ -67,8 +89,487 @@ void test_rb_simple(void)
     printf("%s", get);
 }
 
+void test_rb_elem(void)
+{
+    // Sample structure pushed through the element ring buffer
+    typedef struct
+    {
+        uint32_t timestamp;
+        int32_t value[5];
+    } sample;
+
+    sample buffer[8];
+    sample put[6], get[6];
+    ring_buffer_elem RB;
+    uint32_t i;
+
+    // Initialize the element RingBuffer handle, 8 elements of sizeof(sample) bytes
+    Ring_Buffer_Elem_Init(&RB, buffer, sizeof(sample), 8);
+
+    for (i = 0; i < 6; i++)
+    {
+        put[i].timestamp = i;
+        put[i].value[0] = i * 10;
+    }
+
+    // Move the pointers near the end of the array, then push 6 elements across the wrap point
+    Ring_Buffer_Elem_Write_Multi(&RB, put, 5);
+    Ring_Buffer_Elem_Delete(&RB, 5);
+    Ring_Buffer_Elem_Write_Multi(&RB, put, 6);
+
+    Ring_Buffer_Elem_Read(&RB, &get[0]);
+    Ring_Buffer_Elem_Read_Multi(&RB, &get[1], Ring_Buffer_Elem_Get_Length(&RB));
+    for (i = 0; i < 6; i++)
+        printf("%u:%d ", get[i].timestamp, get[i].value[0]);
+    printf("\r\n");
+}
+
+void test_rb_spsc(void)
+{
+    // Buffer size of the SPSC ring buffer must be a power of two
+    static uint8_t buffer[Read_BUFFER_SIZE];
+    static ring_buffer_spsc RB;
+    uint8_t get[16] = {0};
+
+    Ring_Buffer_SPSC_Init(&RB, buffer, Read_BUFFER_SIZE);
+
+    // Producer side, normally in the receive interrupt or the writer thread
+    Ring_Buffer_SPSC_Write_String(&RB, "hello spsc", 10);
+    Ring_Buffer_SPSC_Write_Byte(&RB, '!');
+
+    // Consumer side, normally in the main loop or the reader thread
+    Ring_Buffer_SPSC_Read_String(&RB, get, Ring_Buffer_SPSC_Get_Length(&RB));
+    printf("%s\r\n", get);
+
+    // Batched mode, tail is published every 8 bytes or on flush, head is released every 8 bytes
+    Ring_Buffer_SPSC_Set_Batch(&RB, 8, 8);
+    Ring_Buffer_SPSC_Write_String(&RB, "abc", 3);
+    printf("%u ", Ring_Buffer_SPSC_Get_Length(&RB)); // Staged data is not visible to the consumer yet
+    Ring_Buffer_SPSC_Flush(&RB);
+    printf("%u\r\n", Ring_Buffer_SPSC_Get_Length(&RB));
+}
+
+void test_rb_broadcast(void)
+{
+    // One write is read by every reader
+    uint8_t buffer[16];
+    ring_buffer_broadcast RB;
+    uint8_t logger, parser;
+    uint8_t get[16] = {0};
+
+    Ring_Buffer_Broadcast_Init(&RB, buffer, 16, RING_BUFFER_BROADCAST_OVERWRITE);
+    Ring_Buffer_Broadcast_Add_Reader(&RB, &logger);
+    Ring_Buffer_Broadcast_Add_Reader(&RB, &parser);
+
+    Ring_Buffer_Broadcast_Write_String(&RB, "0123456789", 10);
+    Ring_Buffer_Broadcast_Read_String(&RB, logger, get, 10); // Logger keeps up
+    printf("%s ", get);
+
+    // Parser is slow, the second write laps it and it only keeps the newest 16 bytes
+    Ring_Buffer_Broadcast_Write_String(&RB, "abcdefghij", 10);
+    printf("%u %u ", Ring_Buffer_Broadcast_Check_Lapped(&RB, parser), Ring_Buffer_Broadcast_Get_Length(&RB, parser));
+    Ring_Buffer_Broadcast_Read_String(&RB, parser, get, 16);
+    printf("%.16s\r\n", get);
+}
+
+void test_rb_sequence(void)
+{
+    // Slots are processed in place by two stages: decode then persist, normally each stage runs in its own thread
+    static uint32_t slots[8];
+    static ring_buffer_sequence RB;
+    uint8_t decode, persist;
+    uint32_t first, number, i;
+
+    Ring_Buffer_Sequence_Init(&RB, slots, sizeof(uint32_t), 8);
+    Ring_Buffer_Sequence_Add_Stage(&RB, RING_BUFFER_SEQUENCE_PRODUCER, &decode);
+    Ring_Buffer_Sequence_Add_Stage(&RB, decode, &persist);
+
+    // Producer claims 3 slots, fills them in place and publishes them
+    Ring_Buffer_Sequence_Claim(&RB, 3, &first);
+    for (i = 0; i < 3; i++)
+        *(uint32_t *)Ring_Buffer_Sequence_Get_Slot(&RB, first + i) = i + 1;
+    Ring_Buffer_Sequence_Publish(&RB);
+
+    // Persist stage sees nothing until decode has committed
+    printf("%u ", Ring_Buffer_Sequence_Available(&RB, persist, &first));
+    number = Ring_Buffer_Sequence_Available(&RB, decode, &first);
+    for (i = 0; i < number; i++)
+        *(uint32_t *)Ring_Buffer_Sequence_Get_Slot(&RB, first + i) *= 10;
+    Ring_Buffer_Sequence_Commit(&RB, decode, number);
+
+    number = Ring_Buffer_Sequence_Available(&RB, persist, &first);
+    for (i = 0; i < number; i++)
+        printf("%u ", *(uint32_t *)Ring_Buffer_Sequence_Get_Slot(&RB, first + i));
+    Ring_Buffer_Sequence_Commit(&RB, persist, number);
+    printf("\r\n");
+}
+
+void test_rb_chain(void)
+{
+    // Pool of 16-byte segments, the buffer only holds the segments its data needs
+    static void *pool_buffer[64];
+    ring_buffer_pool pool;
+    ring_buffer_chain RB;
+    uint8_t get[48] = {0};
+
+    Ring_Buffer_Pool_Init(&pool, pool_buffer, sizeof(pool_buffer), 16);
+    Ring_Buffer_Chain_Init(&RB, &pool);
+
+    Ring_Buffer_Chain_Write_String(&RB, "a burst longer than one segment", 31);
+    printf("%u ", pool.segment_count - pool.free_count); // Two segments linked
+
+    Ring_Buffer_Chain_Read_String(&RB, get, Ring_Buffer_Chain_Get_Length(&RB));
+    printf("%u %s\r\n", pool.segment_count - pool.free_count, get); // Drained segments are back in the pool
+}
+
+void test_rb_pool_shared(void)
+{
+    // Many buffers (one per device) draw from one pool, each limited to 2 segments
+    static void *pool_buffer[64];
+    ring_buffer_pool pool;
+    ring_buffer_pool_stats stats;
+    ring_buffer_chain device[4];
+    uint8_t i;
+
+    Ring_Buffer_Pool_Init(&pool, pool_buffer, sizeof(pool_buffer), 16);
+    for (i = 0; i < 4; i++)
+    {
+        Ring_Buffer_Chain_Init(&device[i], &pool);
+        Ring_Buffer_Chain_Set_Limit(&device[i], 2);
+    }
+
+    Ring_Buffer_Chain_Write_String(&device[0], "0123456789ABCDEF0123", 20);
+    printf("%u ", Ring_Buffer_Chain_Write_String(&device[0], "0123456789ABCDEF", 16)); // Over the limit of device 0
+    Ring_Buffer_Chain_Write_String(&device[1], "hello", 5);
+
+    Ring_Buffer_Pool_Get_Stats(&pool, &stats);
+    printf("%u/%u peak %u\r\n", stats.used_count, stats.segment_count, stats.peak_used);
+}
+
+void test_rb_crc(void)
+{
+    // Checksum is computed while the frame is copied in and out, no extra pass
+    uint8_t buffer[Read_BUFFER_SIZE];
+    ring_buffer RB;
+    ring_buffer_crc crc_tx, crc_rx;
+    uint8_t get[16];
+
+    Ring_Buffer_Init(&RB, buffer, Read_BUFFER_SIZE);
+    Ring_Buffer_CRC_Init(&crc_tx, RING_BUFFER_CRC32);
+    Ring_Buffer_CRC_Init(&crc_rx, RING_BUFFER_CRC32);
+
+    Ring_Buffer_Write_String_CRC(&RB, "123456789", 9, &crc_tx);
+    Ring_Buffer_Read_String_CRC(&RB, get, 9, &crc_rx);
+    printf("%08X %08X\r\n", Ring_Buffer_CRC_Get(&crc_tx), Ring_Buffer_CRC_Get(&crc_rx)); // CBF43926
+}
+
+void test_rb_large(void)
+{
+    // size_t pointers, on a 64-bit build the array can be larger than 4 GB (e.g. from Ring_Buffer_Alloc_Storage)
+    static uint8_t buffer[1024], frame[600], check[600];
+    ring_buffer_large RB;
+    uint8_t get[8] = {0};
+    size_t i;
+
+    for (i = 0; i < sizeof(frame); i++)
+        frame[i] = (uint8_t)(i * 7 + 1);
+    Ring_Buffer_Large_Init(&RB, buffer, sizeof(buffer));
+    Ring_Buffer_Large_Write_String(&RB, frame, sizeof(frame)); // A frame longer than 255 bytes
+    Ring_Buffer_Large_Write_String(&RB, "large", 5);
+    Ring_Buffer_Large_Read_String(&RB, check, sizeof(check));  // Read back in one call
+    Ring_Buffer_Large_Read_String(&RB, get, (size_t)Ring_Buffer_Large_Get_Length(&RB));
+    printf("%s %s %u\r\n", memcmp(frame, check, sizeof(frame)) == 0 ? "frame ok" : "frame corrupted", get, (uint32_t)Ring_Buffer_Large_Get_FreeSize(&RB));
+}
+
+void test_rb_line(void)
+{
+    // Lines are returned in place, no copy
+    uint8_t buffer[24];
+    ring_buffer RB;
+    ring_buffer_line line;
+    ring_buffer_span span[2];
+    uint8_t result;
+
+    Ring_Buffer_Init(&RB, buffer, sizeof(buffer));
+    Ring_Buffer_Line_Init(&line, &RB, 8);
+    Ring_Buffer_Write_String(&RB, "AT+OK\r\nRE", 9);
+    Ring_Buffer_Write_String(&RB, "ADY\n0123456789", 14); // The partial "RE" is not scanned again
+    while ((result = Ring_Buffer_Line_Get(&line, span)) != RING_BUFFER_LINE_NONE)
+    {
+        printf("%u [%.*s%.*s]\r\n", result, (int)span[0].lenght, span[0].addr, (int)span[1].lenght, span[1].addr);
+        Ring_Buffer_Line_Release(&line);
+    }
+}
+
+void test_rb_frame(void)
+{
+    // Frames are decoded straight from the buffer array, no byte-by-byte reads
+    uint8_t buffer[32];
+    ring_buffer RB;
+    ring_buffer_frame frame;
+    uint8_t get[16], result;
+    uint32_t lenght;
+
+    Ring_Buffer_Init(&RB, buffer, sizeof(buffer));
+    Ring_Buffer_Frame_Init(&frame, &RB, RING_BUFFER_FRAME_COBS);
+    Ring_Buffer_Frame_Write(&frame, "\x11\x00\x22", 3);        // Encoded 02 11 02 22 00
+    Ring_Buffer_Write_String(&RB, "\x03\x33", 2);                // Noise, then a frame with a block cut short
+    Ring_Buffer_Write_String(&RB, "\x00", 1);
+    while ((result = Ring_Buffer_Frame_Read(&frame, get, sizeof(get), &lenght)) != RING_BUFFER_FRAME_NONE)
+    {
+        if (result == RING_BUFFER_FRAME_READY)
+            printf("frame %u: %02X %02X %02X\r\n", lenght, get[0], get[1], get[2]);
+        else
+            printf("frame dropped\r\n");
+    }
+}
+
+void test_rb_transfer(void)
+{
+    // RX to TX bridge, no temporary array
+    uint8_t rx_buffer[16], tx_buffer[8];
+    ring_buffer RX, TX;
+    uint8_t get[16] = {0};
+    uint32_t moved;
+
+    Ring_Buffer_Init(&RX, rx_buffer, sizeof(rx_buffer));
+    Ring_Buffer_Init(&TX, tx_buffer, sizeof(tx_buffer));
+    Ring_Buffer_Write_String(&TX, "TX", 2);
+    Ring_Buffer_Write_String(&RX, "bridge data", 11);
+    moved = Ring_Buffer_Transfer(&RX, &TX); // Only as much as TX has room for
+    Ring_Buffer_Read_String(&TX, get, Ring_Buffer_Get_Length(&TX));
+    printf("moved %u [%s] left %u\r\n", moved, get, Ring_Buffer_Get_Length(&RX));
+}
+
+void test_rb_time(void)
+{
+    // Time range read, the index is searched instead of the data
+    uint8_t buffer[64];
+    ring_buffer RB;
+    ring_buffer_time index;
+    ring_buffer_time_entry entries[8];
+    ring_buffer_span span[2];
+
+    Ring_Buffer_Init(&RB, buffer, sizeof(buffer));
+    Ring_Buffer_Time_Init(&index, &RB, entries, 8, 0); // One entry per write
+    Ring_Buffer_Time_Write(&index, "t10 ", 4, 10);
+    Ring_Buffer_Time_Write(&index, "t20 ", 4, 20);
+    Ring_Buffer_Time_Write(&index, "t30 ", 4, 30);
+    Ring_Buffer_Time_Write(&index, "t40 ", 4, 40);
+    if (Ring_Buffer_Time_Query(&index, 15, 30, span) == RING_BUFFER_SUCCESS)
+        printf("[%.*s%.*s]\r\n", (int)span[0].lenght, span[0].addr, (int)span[1].lenght, span[1].addr);
+}
+
+#ifdef RING_BUFFER_STATS
+void test_rb_stats(void)
+{
+    // Counters are only compiled in with RING_BUFFER_STATS
+    uint8_t buffer[8];
+    ring_buffer RB;
+    ring_buffer_stats stats;
+    uint8_t get[8];
+
+    Ring_Buffer_Init(&RB, buffer, 8);
+    Ring_Buffer_Write_String(&RB, "123456", 6);
+    Ring_Buffer_Read_String(&RB, get, 4);
+    Ring_Buffer_Write_String(&RB, "ABCD", 4);      // Wraps, split copy
+    Ring_Buffer_Write_String(&RB, "overflow", 8); // Rejected
+    Ring_Buffer_Find_Keyword(&RB, 'C', 1);
+
+    Ring_Buffer_Get_Stats(&RB, &stats);
+    printf("in %u out %u reject %u high %u split %u scan %u avg %u\r\n",
+           (uint32_t)stats.bytes_in, (uint32_t)stats.bytes_out, stats.write_reject, stats.high_water,
+           stats.split_copy, (uint32_t)stats.keyword_scan, (uint32_t)(stats.occupancy_sum / stats.occupancy_time));
+}
+#endif
+
+#ifdef RING_BUFFER_TRACE
+void test_rb_trace(void)
+{
+    // Histograms are only compiled in with RING_BUFFER_TRACE
+    uint8_t buffer[Read_BUFFER_SIZE];
+    ring_buffer RB;
+    static ring_buffer_trace trace;
+    uint8_t get[4];
+    uint32_t i;
+
+    Ring_Buffer_Init(&RB, buffer, Read_BUFFER_SIZE);
+    Ring_Buffer_Trace_Init(&trace, 4); // Timestamp every 4th write
+    Ring_Buffer_Trace_Attach(&RB, &trace);
+    for (i = 0; i < 64; i++)
+    {
+        Ring_Buffer_Write_String(&RB, "DATA", 4);
+        if (i % 2) // Consumer reads at half the rate, the buffer fills up
+            Ring_Buffer_Read_String(&RB, get, 4);
+    }
+    printf("occupancy p50 %u max %u, latency p50 %u ticks\r\n",
+           (uint32_t)Ring_Buffer_Trace_Percentile(trace.occupancy, RING_BUFFER_TRACE_OCCUPANCY_BUCKETS, 500),
+           (uint32_t)Ring_Buffer_Trace_Percentile(trace.occupancy, RING_BUFFER_TRACE_OCCUPANCY_BUCKETS, 1000),
+           (uint32_t)Ring_Buffer_Trace_Percentile(trace.latency, RING_BUFFER_TRACE_LATENCY_BUCKETS, 500));
+}
+#endif
+
+#ifdef RING_BUFFER_NT_COPY
+void test_rb_nt_copy(void)
+{
+    // Copies from the threshold up bypass the cache, only compiled in with RING_BUFFER_NT_COPY
+    static uint8_t buffer[4096], data[3000], get[3000];
+    ring_buffer_large RB;
+    size_t i;
+
+    for (i = 0; i < sizeof(data); i++)
+        data[i] = (uint8_t)i;
+    Ring_Buffer_Copy_Set_Threshold(1024);                 // Low threshold so the demo takes the large path
+    Ring_Buffer_Large_Init(&RB, buffer, sizeof(buffer));
+    Ring_Buffer_Large_Write_String(&RB, data, 2000);
+    Ring_Buffer_Large_Read_String(&RB, get, 2000);
+    Ring_Buffer_Large_Write_String(&RB, data, sizeof(data)); // Wraps, split in two copies
+    Ring_Buffer_Large_Read_String(&RB, get, sizeof(get));
+    Ring_Buffer_Copy_Set_Threshold(RING_BUFFER_COPY_THRESHOLD);
+    printf("method %u %s\r\n", Ring_Buffer_Copy_Get_Method(), memcmp(data, get, sizeof(data)) ? "mismatch" : "ok");
+}
+#endif
+
+#if defined(__linux__)
+void test_rb_alloc(void)
+{
+    // Storage from mmap, resized with mremap, stored data survives growing and shrinking
+    ring_buffer_alloc_config config = {RING_BUFFER_PAGE_NORMAL, 1, 1, RING_BUFFER_NUMA_ANY};
+    static uint8_t data[6000], get[6000];
+    ring_buffer RB;
+    ring_buffer_mem mem;
+    uint8_t grow, shrink;
+    size_t i;
+
+    for (i = 0; i < sizeof(data); i++)
+        data[i] = (uint8_t)(i * 5 + 3);
+    if (Ring_Buffer_Alloc_Init(&RB, &mem, 8192, &config) == RING_BUFFER_ERROR)
+    {
+        printf("alloc failed\r\n");
+        return;
+    }
+    Ring_Buffer_Write_String(&RB, data, 6000);
+    Ring_Buffer_Read_String(&RB, get, 6000);
+    Ring_Buffer_Write_String(&RB, data, 4000);        // Wraps at the end of the array
+    grow = Ring_Buffer_Alloc_Resize(&RB, &mem, 32768); // The shorter wrapped part is moved after the old end
+    Ring_Buffer_Write_String(&RB, data + 4000, 2000);
+    shrink = Ring_Buffer_Alloc_Resize(&RB, &mem, 8192); // The data is compacted before the mapping is reduced
+    Ring_Buffer_Read_String(&RB, get, 6000);
+    printf("grow %u shrink %u %s %u\r\n", grow, shrink, memcmp(data, get, sizeof(data)) ? "mismatch" : "ok", (uint32_t)mem.map_size);
+    Ring_Buffer_Alloc_Free(&RB, &mem);
+}
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+void test_rb_file(void)
+{
+    // The data and the pointers live in the file, a reopened buffer resumes where it stopped
+    const char *path = "/tmp/test_rb_file.bin";
+    ring_buffer_file RB;
+    uint8_t get[8] = {0};
+    uint32_t head, tail, bad_tail = 1;
+    FILE *file;
+
+    remove(path);
+    if (Ring_Buffer_File_Open(&RB, path, 64, RING_BUFFER_FILE_SYNC_ALWAYS, 0) == RING_BUFFER_ERROR)
+    {
+        printf("file open failed\r\n");
+        return;
+    }
+    Ring_Buffer_File_Write_String(&RB, "resume", 6);
+    Ring_Buffer_File_Read_String(&RB, get, 2);
+    Ring_Buffer_File_Close(&RB);
+    if (Ring_Buffer_File_Open(&RB, path, 0, RING_BUFFER_FILE_SYNC_ALWAYS, 0) == RING_BUFFER_ERROR) // Size taken from the file
+    {
+        printf("file reopen failed\r\n");
+        return;
+    }
+    head = RB.ring.head;
+    tail = RB.ring.tail;
+    Ring_Buffer_File_Read_String(&RB, get, Ring_Buffer_Get_Length(&RB.ring));
+    Ring_Buffer_File_Close(&RB);
+    // Damage the saved tail pointer, it no longer agrees with head + length and the file is refused
+    file = fopen(path, "r+b");
+    fseek(file, (long)offsetof(ring_buffer_file_header, tail), SEEK_SET);
+    fwrite(&bad_tail, sizeof(bad_tail), 1, file);
+    fclose(file);
+    if (Ring_Buffer_File_Open(&RB, path, 0, RING_BUFFER_FILE_SYNC_ALWAYS, 0) == RING_BUFFER_SUCCESS)
+    {
+        printf("%s %u %u accepted\r\n", get, head, tail);
+        Ring_Buffer_File_Close(&RB);
+    }
+    else
+        printf("%s %u %u rejected\r\n", get, head, tail);
+    remove(path);
+}
+
+void test_rb_shm(void)
+{
+    // Two processes would each map the objects at their own address, here two handles in one process stand in for them;
+    // One object per direction, each with one producer and one consumer
+    ring_buffer_shm request_tx, request_rx, reply_tx, reply_rx;
+    uint8_t get[8] = {0}, reply[8] = {0};
+
+    Ring_Buffer_SHM_Unlink("/test_rb_request");
+    Ring_Buffer_SHM_Unlink("/test_rb_reply");
+    if (Ring_Buffer_SHM_Create(&request_tx, "/test_rb_request", 64, 0600) == RING_BUFFER_ERROR)
+    {
+        printf("shm create failed\r\n");
+        return;
+    }
+    if (Ring_Buffer_SHM_Create(&reply_tx, "/test_rb_reply", 64, 0600) == RING_BUFFER_ERROR)
+    {
+        printf("shm create failed\r\n");
+        Ring_Buffer_SHM_Detach(&request_tx);
+        Ring_Buffer_SHM_Unlink("/test_rb_request");
+        return;
+    }
+    Ring_Buffer_SHM_Attach(&request_rx, "/test_rb_request");
+    Ring_Buffer_SHM_Attach(&reply_rx, "/test_rb_reply");
+    Ring_Buffer_SHM_Write_String(&request_tx, "ping", 4);
+    Ring_Buffer_SHM_Read_String(&request_rx, get, 4);
+    Ring_Buffer_SHM_Write_String(&reply_tx, "pong", 4);
+    Ring_Buffer_SHM_Read_String(&reply_rx, reply, 4);
+    printf("%s %s %p %p %u\r\n", get, reply, (void *)request_tx.array_addr, (void *)request_rx.array_addr, Ring_Buffer_SHM_Get_FreeSize(&request_tx));
+    Ring_Buffer_SHM_Detach(&request_tx);
+    Ring_Buffer_SHM_Detach(&request_rx);
+    Ring_Buffer_SHM_Detach(&reply_tx);
+    Ring_Buffer_SHM_Detach(&reply_rx);
+    Ring_Buffer_SHM_Unlink("/test_rb_request");
+    Ring_Buffer_SHM_Unlink("/test_rb_reply");
+}
+#endif
+
 void test_ringbuffer(void)
 {
     test_rb_simple();
     test_rb_find_keyword();
+    test_rb_elem();
+    test_rb_spsc();
+    test_rb_broadcast();
+    test_rb_sequence();
+    test_rb_chain();
+    test_rb_pool_shared();
+    test_rb_crc();
+    test_rb_large();
+    test_rb_line();
+    test_rb_frame();
+    test_rb_transfer();
+    test_rb_time();
+#ifdef RING_BUFFER_STATS
+    test_rb_stats();
+#endif
+#ifdef RING_BUFFER_TRACE
+    test_rb_trace();
+#endif
+#ifdef RING_BUFFER_NT_COPY
+    test_rb_nt_copy();
+#endif
+#if defined(__linux__)
+    test_rb_alloc();
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+    test_rb_file();
+    test_rb_shm();
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+#include "ring_buffer_object.hpp"
+
+void test_rb_object(void)
+{
+    // Ring of 4 messages, messages are moved in and out without serialization
+    ring_buffer_object<std::string, 4> RB;
+    ring_buffer_object<std::unique_ptr<int>, 2> RB_ptr;
+    std::string get;
+    std::unique_ptr<int> get_ptr;
+
+    RB.emplace_back("hello");
+    RB.emplace_back(5, '!');
+    RB.push_back(std::string("world"));
+
+    while (RB.pop_front(get))
+        printf("%s ", get.c_str());
+    printf("\r\n");
+
+    // Move-only elements, the remaining element is destroyed by clear
+    RB_ptr.emplace_back(new int(1));
+    RB_ptr.emplace_back(new int(2));
+    RB_ptr.pop_front(get_ptr);
+    printf("%d %u\r\n", *get_ptr, RB_ptr.size());
+    RB_ptr.clear();
+}